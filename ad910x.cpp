@@ -1,335 +1,1682 @@
-/******************************************************************************
-    @file:  ad910x.cpp
- 
-    @brief: Implements device-specific SPI and pattern generation functions,
-            and printing of data from SPI read to text-based user interface
--------------------------------------------------------------------------------
-    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
-    This software is proprietary to Analog Devices, Inc. and its licensors.
-
-    Licensed under the Apache License, Version 2.0 (the "License");
-    you may not use this file except in compliance with the License.
-
-    Unless required by applicable law or agreed to in writing, software
-    distributed under the License is distributed on an "AS IS" BASIS,
-    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-    See the License for the specific language governing permissions and
-    limitations under the License. 
-******************************************************************************/
-#include "mbed.h"
-#include "ad910x.h"
-
-extern UnbufferedSerial pc;
-
-#pragma region (SINGLE-BOARD CODE)
-AD910x_SINGLE::AD910x_SINGLE( PinName CSB,
-               PinName MOSI,
-               PinName MISO,
-               PinName SCK,
-               PinName RESETB,
-               PinName TRIGGERB ) :
-               spi( MOSI, MISO, SCK ), csb( CSB ), resetb( RESETB ), triggerb( TRIGGERB ) {
-}
-
-//  * @brief Reset AD910x SPI registers to default values
-//  * @param none
-//  * @return none
-
-void AD910x_SINGLE::AD910x_reg_reset() {
-    resetb = 0;
-    wait_us( 10 );
-    resetb = 1;
-}
-
-//  * @brief Print register address and data in hexadecimal format
-//  * @param addr - SPI/SRAM register address
-//  * @param data - 16-bit data
-//  * @return none
-
-void AD910x_SINGLE::print_data( uint16_t addr, uint16_t data ) {
-    printf( "0x%04X, 0x%04X\n", addr, data );
-}
-
-//  * @brief Start pattern generation by setting AD910x trigger pin to 0
-//  * @param none
-//  * @return none
-
-void AD910x_SINGLE::AD910x_start_pattern() {
-    triggerb = 0;
-}
-
-//  * @brief Stop pattern generation by setting AD910x trigger pin to 1
-//  * @param none
-//  * @return none
-
-void AD910x_SINGLE::AD910x_stop_pattern() {
-    triggerb = 1;
-}
-
-//  * @brief Write data to SRAM
-//  * @param data[] - array of data to be written to SRAM
-//  * @return none
-
-void AD910x_SINGLE::AD910x_update_sram( int16_t data[] ) { 
-    spi_write( 0x001E, 0x0004 );
-    
-    int16_t data_shifted = 0;
-    
-    uint16_t sram_add = 0x6000;
-    
-    for ( int i=0; i<4096; i++ ) {
-        data_shifted = data[i] << 2;
-        spi_write( sram_add+i, data_shifted );
-    }
-    
-    spi_write( 0x001E, 0x0000 );   
-}
-
-//  * @brief Read from SRAM and print data
-//  * @param n - number of SRAM addresses to be read from
-//  * @return none
-
-void AD910x_SINGLE::AD910x_print_sram( uint16_t n ) {
-    spi_write( 0x001E, 0x000C );
-    
-    int16_t data_shifted = 0;
-    
-    uint16_t sram_add = 0x6000;
-    
-    for ( int i=0; i<n; i++ ) {
-        data_shifted = spi_read( sram_add+i ) >> 2;
-        print_data( sram_add+i, data_shifted );
-    }
-    
-    spi_write( 0x001E, 0x0000 );
-}
-
-//  * @brief Write to SPI registers, and read and print new register values
-//  * @param data[] - array of data to written to SPI registers
-//  * @return none
-
-void AD910x_SINGLE::AD910x_update_regs( uint16_t data[] ) {
-    uint16_t data_display = 0;
-     
-    for ( int i=0; i<66; i++ ) {
-        spi_write( reg_add[i], data[i] );
-        data_display = spi_read( reg_add[i] );
-        print_data( reg_add[i], data_display );
-    }
-}
-
-// ********************************************************* //
-// SPI FUNCTIONS 
-// ********************************************************* //
-
-//  * @brief Set AD910x SPI word length, mode, frequency
-//  * @param reg_len - SPI word length
-//  * @param mode - SPI clock polarity, clock and data phase
-//  * @param hz - SPI bus frequency in hz
-//  * @return none
-
-void AD910x_SINGLE::spi_init( uint8_t reg_len, uint8_t mode, uint32_t hz ) {
-    spi.format( reg_len, mode );
-    spi.frequency( hz );
-}
-
-//  * @brief Write 16-bit data to AD910x SPI/SRAM register
-//  * @param addr - SPI/SRAM address
-//  * @param data - data to be written to register address
-//  * @return none
-
-void AD910x_SINGLE::spi_write( uint16_t addr, int16_t data ) {
-    csb = 0;
-    
-    spi.write( addr );
-    spi.write( data );
-    
-    csb = 1;
-    wait_us( 1 );
-}
-
-//  * @brief Read 16-bit data from AD910x SPI/SRAM register
-//  * @param addr - SPI/SRAM address
-//  * @return reg_data - data returned by AD910x
-
-int16_t AD910x_SINGLE::spi_read( uint16_t addr ) {
-    csb = 0;
-    
-    uint16_t read_addr;
-    int16_t reg_data;
-    
-    read_addr = 0x8000+addr;
-    spi.write( read_addr );
-    reg_data = spi.write( 0 );
-    
-    csb = 1;
-    wait_us( 1 );
-    
-    return reg_data;
-}
-#pragma endregion
-
-#pragma region (MULTI-BOARD CODE)
-AD910x_MULTI::AD910x_MULTI( PinName CSB1,
-               PinName CSB2,
-               PinName MOSI,
-               PinName MISO,
-               PinName SCK,
-               PinName RESETB,
-               PinName TRIGGERB ) :
-               spi( MOSI, MISO, SCK ), csb1( CSB1 ), csb2( CSB2 ), resetb( RESETB ), triggerb( TRIGGERB ) {
-}
-
-//  * @brief Reset AD910x SPI registers to default values
-//  * @param none
-//  * @return none
-
-void AD910x_MULTI::AD910x_reg_reset() {
-    resetb = 0;
-    wait_us( 10 );
-    resetb = 1;
-}
-
-//  * @brief Print register address and data in hexadecimal format
-//  * @param addr - SPI/SRAM register address
-//  * @param data - 16-bit data
-//  * @return none
-
-void AD910x_MULTI::print_data( uint16_t addr, uint16_t data ) {
-    printf( "0x%04X, 0x%04X\n", addr, data );
-}
-
-//  * @brief Start pattern generation by setting AD910x trigger pin to 0
-//  * @param none
-//  * @return none
-
-void AD910x_MULTI::AD910x_start_pattern() {
-    triggerb = 0;
-}
-
-//  * @brief Stop pattern generation by setting AD910x trigger pin to 1
-//  * @param none
-//  * @return none
-
-void AD910x_MULTI::AD910x_stop_pattern() {
-    triggerb = 1;
-}
-
-//  * @brief Write data to SRAM
-//  * @param data[] - array of data to be written to SRAM
-//  * @return none
-
-void AD910x_MULTI::AD910x_update_sram( bool devnum, int16_t data[] ) {
-    spi_write( devnum, 0x001E, 0x0004 );
-    
-    int16_t data_shifted = 0;
-    
-    uint16_t sram_add = 0x6000;
-    
-    for ( int i=0; i<4096; i++ ) {
-        data_shifted = data[i] << 2;
-        spi_write( devnum, sram_add+i, data_shifted );
-    }
-    
-    spi_write( devnum, 0x001E, 0x0000 );
-}
-
-//  * @brief Read from SRAM and print data
-//  * @param n - number of SRAM addresses to be read from
-//  * @return none
-
-void AD910x_MULTI::AD910x_print_sram( bool devnum, uint16_t n ) {
-    spi_write( devnum, 0x001E, 0x000C );
-    
-    int16_t data_shifted = 0;
-    
-    uint16_t sram_add = 0x6000;
-    
-    for ( int i=0; i<n; i++ ) {
-        data_shifted = spi_read( devnum, sram_add+i ) >> 2;
-        print_data( sram_add+i, data_shifted );
-    }
-    
-    spi_write( devnum, 0x001E, 0x0000 );
-}
-
-//  * @brief Write to SPI registers, and read and print new register values
-//  * @param data[] - array of data to written to SPI registers
-//  * @return none
-
-void AD910x_MULTI::AD910x_update_regs( bool devnum, uint16_t data[] ) {  
-    uint16_t data_display = 0;
-     
-    for ( int i=0; i<66; i++ ) {
-        spi_write( devnum, reg_add[i], data[i] );
-        data_display = spi_read( devnum, reg_add[i] );
-        print_data( reg_add[i], data_display );
-    }
-}
-
-// ******************************************************** //
-// SPI FUNCTIONS 
-// ******************************************************** //
-
-//  * @brief Set AD910x SPI word length, mode, frequency
-//  * @param reg_len - SPI word length
-//  * @param mode - SPI clock polarity, clock and data phase
-//  * @param hz - SPI bus frequency in hz
-//  * @return none
-
-void AD910x_MULTI::spi_init( uint8_t reg_len, uint8_t mode, uint32_t hz ) {
-    spi.format( reg_len, mode );
-    spi.frequency( hz );
-    spi_disable_dev();
-}
-
-void AD910x_MULTI::spi_en_dev( bool dev_id ) {
-    if ( dev_id ) {
-        csb2 = 0;
-    } else {
-        csb1 = 0;
-    }
-}
-
-void AD910x_MULTI::spi_disable_dev() {
-    csb1 = 1;
-    csb2 = 1;
-}
-
-//  * @brief Write 16-bit data to AD910x SPI/SRAM register
-//  * @param addr - SPI/SRAM address
-//  * @param data - data to be written to register address
-//  * @return none
-
-void AD910x_MULTI::spi_write( bool dev_id, uint16_t addr, int16_t data ) {
-    spi_en_dev( dev_id );
-    
-    spi.write( addr );
-    spi.write( data );
-    
-    wait_us( 1 );
-    
-    spi_disable_dev();
-}
-
-//  * @brief Read 16-bit data from AD910x SPI/SRAM register
-//  * @param addr - SPI/SRAM address
-//  * @return reg_data - data returned by AD910x
-
-int16_t AD910x_MULTI::spi_read( bool dev_id, uint16_t addr ) {
-    uint16_t read_addr;
-    int16_t reg_data;
-    
-    spi_en_dev( dev_id );
-
-    read_addr = 0x8000 + addr;
-    spi.write( read_addr );
-    reg_data = spi.write( 0 );
-    
-    wait_us( 1 );
-    
-    spi_disable_dev();
-    
-    return reg_data;
-}
-#pragma endregion
+/******************************************************************************
+    @file:  ad910x.cpp
+ 
+    @brief: Implements device-specific SPI and pattern generation functions,
+            and printing of data from SPI read to text-based user interface
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "ad910x.h"
+
+#pragma region (COMMON CODE)
+/*** SPI register addresses, in the order of the example register configurations ***/
+const uint16_t AD910x_BASE::reg_add[66] = {0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x001f, 0x0020, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0047, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x001e, 0x001d};
+
+AD910x_BASE::AD910x_BASE( AD910x_Transport &spi_bus, AD910x_Shadow shadows[], uint8_t devs ) :
+        bus( spi_bus ), burst_en( true ), diff_en( true ), reg_cache_en( true ), stats(),
+        log_level( AD910X_LOG_FULL ), log_queue( NULL ), spi_hz( 0 ), spi_edge_hz( 0 ), spi_max_hz( 0 ),
+        verify_mode( AD910X_VERIFY_NONE ), verify_step( 16 ), verify_result(), shadow( shadows ), num_devs( devs ),
+        sram_open( false ), sram_next( 0 ), sram_first( 0 ), sram_nframes( 0 ), stream_mask( 0 ),
+        async_busy( false ), async_event( 0 ), async_mask( 0 ), async_frames( NULL ), async_n( 0 ),
+        async_cb( NULL ), async_ctx( NULL ) {
+}
+
+//  * @brief Reset AD910x SPI registers to default values
+//  * @param none
+//  * @return none
+
+void AD910x_BASE::AD910x_reg_reset() {
+    bus.set_reset( 0 );
+    bus.delay_us( 10 );
+    bus.set_reset( 1 );
+    AD910x_invalidate_sram();
+    
+    // * Registers are known again: all devices hold their reset values * //
+    for ( int d=0; d<num_devs; d++ ) {
+        memset( shadow[d].regs, 0, sizeof( shadow[d].regs ) );
+        for ( size_t i=0; i<sizeof( AD910X_REG_DEFAULTS )/sizeof( AD910X_REG_DEFAULTS[0] ); i++ ) {
+            shadow[d].regs[AD910X_REG_DEFAULTS[i].addr] = AD910X_REG_DEFAULTS[i].val;
+        }
+        memset( shadow[d].reg_known, 0xFF, sizeof( shadow[d].reg_known ) );
+    }
+}
+
+//  * @brief Mark the SRAM shadow of every device unknown, so the next upload writes all words
+//  * @param none
+//  * @return none
+
+void AD910x_BASE::AD910x_invalidate_sram() {
+    for ( int d=0; d<num_devs; d++ ) {
+        memset( shadow[d].sram_known, 0, sizeof( shadow[d].sram_known ) );
+    }
+}
+
+//  * @brief Mark the register shadow of every device unknown, so the next update writes all registers
+//  * @param none
+//  * @return none
+
+void AD910x_BASE::AD910x_invalidate_regs() {
+    for ( int d=0; d<num_devs; d++ ) {
+        memset( shadow[d].reg_known, 0, sizeof( shadow[d].reg_known ) );
+    }
+}
+
+//  * @brief Print register address and data in hexadecimal format
+//  * @param addr - SPI/SRAM register address
+//  * @param data - 16-bit data
+//  * @return none
+
+void AD910x_BASE::print_data( uint16_t addr, uint16_t data ) {
+    printf( "0x%04X, 0x%04X\n", addr, data );
+}
+
+//  * @brief Display register/SRAM data without blocking the SPI path in deferred mode
+//  * @param addr - SPI/SRAM register address
+//  * @param data - 16-bit data
+//  * @return none
+
+void AD910x_BASE::log_data( uint16_t addr, uint16_t data ) {
+    if ( log_level == AD910X_LOG_FULL || ( log_level == AD910X_LOG_DEFERRED && log_queue == NULL ) ) {
+        print_data( addr, data );
+    } else if ( log_level == AD910X_LOG_DEFERRED ) {
+        log_queue->push( addr, data );
+    }
+}
+
+//  * @brief Start pattern generation by setting AD910x trigger pin to 0
+//  * @param none
+//  * @return none
+
+void AD910x_BASE::AD910x_start_pattern() {
+    bus.set_trigger( 0 );
+}
+
+//  * @brief Stop pattern generation by setting AD910x trigger pin to 1
+//  * @param none
+//  * @return none
+
+void AD910x_BASE::AD910x_stop_pattern() {
+    bus.set_trigger( 1 );
+}
+
+//  * @brief Sample source reading from a plain array (see AD910x_SampleSource)
+//  * @param ctx - pointer to the read position of the array
+//  * @param out[] - output samples
+//  * @param max - number of samples requested
+//  * @return max
+
+static uint16_t array_source( void *ctx, int16_t out[], uint16_t max ) {
+    const int16_t **pos = (const int16_t **)ctx;
+    memcpy( out, *pos, max * sizeof( int16_t ) );
+    *pos += max;
+    return max;
+}
+
+//  * @brief Find the SRAM words a register set plays: START_ADDRx..STOP_ADDRx of
+//  *        every channel, merged where they overlap or touch. A channel whose
+//  *        stop address is not above its start address (the reset state of an
+//  *        unused channel) is ignored.
+//  * @param regval[] - register values in reg_add order, as for AD910x_update_regs
+//  * @param ranges[] - output, up to AD910X_CHANNELS ranges in ascending order
+//  * @return number of ranges
+
+uint8_t AD910x_BASE::AD910x_sram_ranges( const uint16_t regval[], AD910x_SramRange ranges[AD910X_CHANNELS] ) {
+    uint16_t start[AD910X_CHANNELS] = {0};
+    uint16_t stop[AD910X_CHANNELS] = {0};
+    uint8_t k = 0;
+    
+    for ( int i=0; i<66; i++ ) {
+        for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+            if ( reg_add[i] == AD910X_REG_START_ADDR( ch ) ) {
+                start[ch] = regval[i] >> AD910X_SRAM_ADDR_SHIFT;
+            } else if ( reg_add[i] == AD910X_REG_STOP_ADDR( ch ) ) {
+                stop[ch] = regval[i] >> AD910X_SRAM_ADDR_SHIFT;
+            }
+        }
+    }
+    
+    // * Insert each channel's range in order, merging it with the ranges it overlaps or touches * //
+    for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+        if ( stop[ch] <= start[ch] ) {
+            continue;
+        }
+        uint16_t lo = start[ch];
+        uint16_t hi = stop[ch] + 1;
+        uint8_t m = 0;
+        AD910x_SramRange merged[AD910X_CHANNELS];
+        bool placed = false;
+        for ( int i=0; i<k; i++ ) {
+            uint16_t r_hi = ranges[i].offset + ranges[i].n;
+            if ( r_hi < lo ) {
+                merged[m++] = ranges[i];
+            } else if ( ranges[i].offset > hi ) {
+                if ( !placed ) {
+                    merged[m++] = { lo, (uint16_t)( hi - lo ) };
+                    placed = true;
+                }
+                merged[m++] = ranges[i];
+            } else {
+                lo = ( ranges[i].offset < lo ) ? ranges[i].offset : lo;
+                hi = ( r_hi > hi ) ? r_hi : hi;
+            }
+        }
+        if ( !placed ) {
+            merged[m++] = { lo, (uint16_t)( hi - lo ) };
+        }
+        memcpy( ranges, merged, m * sizeof( AD910x_SramRange ) );
+        k = m;
+    }
+    return k;
+}
+
+//  * @brief Write data to SRAM
+//  * @param dev_mask - devices to write to
+//  * @param data[] - array of data to be written to SRAM
+//  * @return 0 on success, -1 if another upload is open (nothing is written)
+
+int AD910x_BASE::dev_update_sram( uint32_t dev_mask, const int16_t data[] ) {
+    const int16_t *pos = data;
+    return dev_stream_sram( dev_mask, 0, AD910X_SRAM_SIZE, array_source, &pos );
+}
+
+//  * @brief Write part of SRAM, e.g. one of several short waveforms kept in SRAM at once
+//  * @param dev_mask - devices to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @param data[] - n samples
+//  * @return 0 on success, -1 if the range does not fit in SRAM or another
+//  *         upload is open (nothing is written)
+
+int AD910x_BASE::dev_update_sram_range( uint32_t dev_mask, uint16_t offset, uint16_t n, const int16_t data[] ) {
+    if ( (uint32_t)offset + n > AD910X_SRAM_SIZE ) {
+        return -1;
+    }
+    const int16_t *pos = data;
+    return dev_stream_sram( dev_mask, offset, n, array_source, &pos );
+}
+
+//  * @brief Write the SRAM ranges played by a register set (see AD910x_sram_ranges)
+//  *        and leave the rest of SRAM untouched
+//  * @param dev_mask - devices to write to
+//  * @param image[] - full SRAM image of 4096 samples; only the played words are read
+//  * @param regval[] - register values in reg_add order, as for AD910x_update_regs
+//  * @return number of SRAM words in the played ranges, -1 if a range does not
+//  *         fit or another upload is open (the ranges before it are written)
+
+int AD910x_BASE::dev_update_sram_used( uint32_t dev_mask, const int16_t image[], const uint16_t regval[] ) {
+    AD910x_SramRange ranges[AD910X_CHANNELS];
+    uint8_t k = AD910x_sram_ranges( regval, ranges );
+    int words = 0;
+    
+    for ( int i=0; i<k; i++ ) {
+        if ( dev_update_sram_range( dev_mask, ranges[i].offset, ranges[i].n, image + ranges[i].offset ) != 0 ) {
+            return -1;
+        }
+        words += ranges[i].n;
+    }
+    return words;
+}
+
+//  * @brief Decode a packed waveform into SRAM while it is uploaded, starting at 0x6000
+//  * @param dev_mask - devices to write to
+//  * @param wave - packed waveform
+//  * @return 0 on success, -1 if the packed data ended early (the decoded part is
+//  *         written) or another upload is open
+
+int AD910x_BASE::dev_update_sram_packed( uint32_t dev_mask, const AD910x_PackedWave &wave ) {
+    AD910x_WaveDecoder dec( wave );
+    uint16_t n = ( wave.samples < AD910X_SRAM_SIZE ) ? wave.samples : AD910X_SRAM_SIZE;
+    if ( dev_stream_sram( dev_mask, 0, n, AD910x_WaveDecoder::source, &dec ) != 0 ) {
+        return -1;
+    }
+    return dec.error() ? -1 : 0;
+}
+
+//  * @brief Write n SRAM words taken from a sample source, AD910X_BURST_CHUNK at a time
+//  *        (see sram_stream_write)
+//  * @param dev_mask - devices to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @param source - sample source; the upload ends early if it returns 0
+//  * @param ctx - argument passed to source
+//  * @return 0, -1 if the upload could not be opened (see sram_stream_begin)
+
+int AD910x_BASE::dev_stream_sram( uint32_t dev_mask, uint16_t offset, uint16_t n, AD910x_SampleSource source, void *ctx ) {
+    int16_t chunk[AD910X_BURST_CHUNK];
+    
+    if ( sram_stream_begin( dev_mask, offset, n ) != 0 ) {
+        return -1;
+    }
+    for ( uint16_t i=0; i<n; ) {
+        uint16_t len = source( ctx, chunk, ( n - i < AD910X_BURST_CHUNK ) ? n - i : AD910X_BURST_CHUNK );
+        if ( len == 0 ) {
+            break;
+        }
+        i += stream_put( chunk, len );
+    }
+    sram_stream_end();
+    return 0;
+}
+
+//  * @brief Open an SRAM upload that is fed piecewise with sram_stream_write,
+//  *        e.g. as chunks arrive from the host. Nothing is sent yet.
+//  * @param dev_mask - devices to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @return 0 on success, -1 if the range does not fit or another upload is open
+
+int AD910x_BASE::sram_stream_begin( uint32_t dev_mask, uint16_t offset, uint16_t n ) {
+    if ( stream_mask != 0 || dev_mask == 0 || (uint32_t)offset + n > AD910X_SRAM_SIZE ) {
+        return -1;
+    }
+    stream_mask = dev_mask;
+    stream_pos = offset;
+    stream_stop = offset + n;
+    stream_mem = false;
+    stream_written = 0;
+    stream_skipped = 0;
+    stream_lo = AD910X_SRAM_SIZE;
+    stream_hi = 0;
+    return 0;
+}
+
+//  * @brief Convert samples and add them to the open upload. The burst is
+//  *        closed before returning, so other SPI access may run between two
+//  *        calls, e.g. jobs of other producers on a worker; the next call
+//  *        starts a new burst at the next word and grants memory access again
+//  *        if PAT_STATUS was changed in between.
+//  * @param samples[] - k samples
+//  * @param k - number of samples; samples beyond the range of the upload are dropped
+//  * @return samples taken
+
+uint16_t AD910x_BASE::sram_stream_write( const int16_t samples[], uint16_t k ) {
+    uint16_t taken = stream_put( samples, k );
+    sram_close( stream_mask );
+    return taken;
+}
+
+//  * @brief Add samples to the open upload and leave the burst running for the
+//  *        next call. With diff_en, words that match the shadow are not sent,
+//  *        gaps shorter than AD910X_DIFF_GAP words are bridged inside the
+//  *        running burst, and nothing at all is sent if the SRAM already matches.
+//  * @param samples[] - k samples
+//  * @param k - number of samples; samples beyond the range of the upload are dropped
+//  * @return samples taken
+
+uint16_t AD910x_BASE::stream_put( const int16_t samples[], uint16_t k ) {
+    uint16_t wire[AD910X_BURST_CHUNK];
+    uint16_t taken = 0;
+    
+    if ( stream_mask == 0 ) {
+        return 0;
+    }
+    k = ( k > stream_stop - stream_pos ) ? stream_stop - stream_pos : k;
+    
+    while ( taken < k ) {
+        uint16_t len = ( k - taken < AD910X_BURST_CHUNK ) ? k - taken : AD910X_BURST_CHUNK;
+        AD910x_to_wire( wire, samples + taken, len );
+        
+        for ( int j=0; j<len; j++ ) {
+            uint16_t pos = stream_pos++;
+            uint16_t word = wire[j];
+            
+            if ( diff_en && !sram_dirty( stream_mask, pos, word ) ) {
+                stream_skipped++;
+                continue;
+            }
+            if ( !stream_mem || !( shadow[first_dev( stream_mask )].regs[AD910X_REG_PAT_STATUS] & AD910X_MEM_ACCESS ) ) {
+                dev_write( stream_mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS );
+                stream_mem = true;
+            }
+            // * Skipped words are equal to the shadow: resend them rather than start a new burst * //
+            if ( sram_open && pos > sram_next && pos - sram_next < AD910X_DIFF_GAP ) {
+                for ( uint16_t g=sram_next; g<pos; g++ ) {
+                    sram_put( stream_mask, g, shadow[first_dev( stream_mask )].sram[g] );
+                    stream_written++;
+                    stream_skipped--;
+                }
+            }
+            sram_put( stream_mask, pos, word );
+            stream_written++;
+            stream_lo = ( pos < stream_lo ) ? pos : stream_lo;
+            stream_hi = pos + 1;
+        }
+        taken += len;
+    }
+    return taken;
+}
+
+//  * @brief Finish the open upload: flush the burst, release SRAM to the
+//  *        pattern generator and verify according to verify_mode
+//  * @param none
+//  * @return SRAM words received since sram_stream_begin
+
+uint16_t AD910x_BASE::sram_stream_end() {
+    uint32_t dev_mask = stream_mask;
+    
+    if ( dev_mask == 0 ) {
+        return 0;
+    }
+    sram_close( dev_mask );
+    if ( stream_mem ) {
+        dev_write( dev_mask, AD910X_REG_PAT_STATUS, 0x0000 );
+    }
+    stream_mask = 0;
+    stats.sram_written += stream_written;
+    stats.sram_skipped += stream_skipped;
+    verify_update( dev_mask, NULL, stream_lo, stream_hi );
+    return stream_written + stream_skipped;
+}
+
+//  * @brief Queue one wire-format word of an SRAM upload. In burst mode the
+//  *        address auto-increments after each data word, so consecutive words
+//  *        share one chip-select cycle and one instruction word.
+//  * @param dev_mask - devices to write to
+//  * @param pos - SRAM word (0 = 0x6000)
+//  * @param word - data in wire format
+//  * @return none
+
+void AD910x_BASE::sram_put( uint32_t dev_mask, uint16_t pos, uint16_t word ) {
+    if ( !burst_en ) {
+        dev_write( dev_mask, AD910X_SRAM_ADDR + pos, word );
+        shadow_sram( dev_mask, pos, &word, 1 );
+        return;
+    }
+    
+    if ( !sram_open || pos != sram_next ) {
+        sram_close( dev_mask );
+        bus.select( dev_mask );
+        bus.write( AD910X_SRAM_ADDR + pos );
+        sram_open = true;
+        sram_first = pos;
+    }
+    
+    sram_frames[sram_nframes++] = word;
+    sram_next = pos + 1;
+    
+    if ( sram_nframes == AD910X_BURST_CHUNK ) {
+        bus.write_block( sram_frames, sram_nframes );
+        shadow_sram( dev_mask, sram_first, sram_frames, sram_nframes );
+        sram_first += sram_nframes;
+        sram_nframes = 0;
+    }
+}
+
+//  * @brief Send the queued words and end the running burst
+//  * @param dev_mask - devices of the burst
+//  * @return none
+
+void AD910x_BASE::sram_close( uint32_t dev_mask ) {
+    if ( !sram_open ) {
+        return;
+    }
+    
+    if ( sram_nframes != 0 ) {
+        bus.write_block( sram_frames, sram_nframes );
+        shadow_sram( dev_mask, sram_first, sram_frames, sram_nframes );
+        sram_nframes = 0;
+    }
+    
+    bus.deselect();
+    bus.delay_us( 1 );
+    sram_open = false;
+}
+
+//  * @brief Check an SRAM word against the shadow
+//  * @param dev_mask - devices to check
+//  * @param pos - SRAM word (0 = 0x6000)
+//  * @param word - new word in wire format
+//  * @return true if any device in dev_mask may hold a different value
+
+bool AD910x_BASE::sram_dirty( uint32_t dev_mask, uint16_t pos, uint16_t word ) {
+    for ( int d=0; d<num_devs; d++ ) {
+        if ( !( dev_mask & ( 1u << d ) ) ) {
+            continue;
+        }
+        if ( !( ( shadow[d].sram_known[pos / 32] >> ( pos % 32 ) ) & 1 ) || shadow[d].sram[pos] != word ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//  * @brief Copy written SRAM words into the shadow
+//  * @param dev_mask - devices written to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param frames[] - n words in wire format
+//  * @param n - number of words
+//  * @return none
+
+void AD910x_BASE::shadow_sram( uint32_t dev_mask, uint16_t offset, const uint16_t frames[], uint16_t n ) {
+    for ( int d=0; d<num_devs; d++ ) {
+        if ( !( dev_mask & ( 1u << d ) ) ) {
+            continue;
+        }
+        memcpy( &shadow[d].sram[offset], frames, n * sizeof( uint16_t ) );
+        for ( uint16_t i=offset; i<offset+n; i++ ) {
+            shadow[d].sram_known[i / 32] |= 1u << ( i % 32 );
+        }
+    }
+}
+
+//  * @brief Convert SRAM words to wire format: one instruction word, then the
+//  *        saturated and shifted data (see AD910x_to_wire)
+//  * @param frames[] - buffer of n+1 frames (AD910X_SRAM_FRAMES for a full upload)
+//  * @param data[] - array of n data words: int16/int32 samples or normalized floats
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @return none
+
+void AD910x_BASE::AD910x_prepare_sram( uint16_t frames[], const int16_t data[], uint16_t offset, uint16_t n ) {
+    frames[0] = AD910X_SRAM_ADDR + offset;
+    AD910x_to_wire( &frames[1], data, n );
+}
+
+void AD910x_BASE::AD910x_prepare_sram( uint16_t frames[], const int32_t data[], uint16_t offset, uint16_t n ) {
+    frames[0] = AD910X_SRAM_ADDR + offset;
+    AD910x_to_wire( &frames[1], data, n );
+}
+
+void AD910x_BASE::AD910x_prepare_sram( uint16_t frames[], const float data[], uint16_t offset, uint16_t n ) {
+    frames[0] = AD910X_SRAM_ADDR + offset;
+    AD910x_to_wire( &frames[1], data, n );
+}
+
+//  * @brief Start writing prepared frames to SRAM. The frames are streamed by DMA
+//  *        where the transport supports it; the SPI bus belongs to the upload
+//  *        until AD910x_finish_sram() returns.
+//  * @param dev_mask - devices to write to
+//  * @param frames[] - n+1 frames from AD910x_prepare_sram; must stay valid until done
+//  * @param n - number of data words
+//  * @param cb - optional completion callback, may run in interrupt context
+//  * @param ctx - argument passed to cb
+//  * @return 0 if the upload started, -1 if another upload is pending
+
+int AD910x_BASE::dev_update_sram_async( uint32_t dev_mask, const uint16_t frames[], uint16_t n, AD910x_Callback cb, void *ctx ) {
+    if ( async_mask != 0 ) {
+        return -1;
+    }
+    
+    dev_write( dev_mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS );
+    
+    async_mask = dev_mask;
+    async_frames = frames;
+    async_n = n;
+    async_cb = cb;
+    async_ctx = ctx;
+    async_event = 0;
+    async_busy = true;
+    
+    bus.select( dev_mask );
+    if ( bus.write_block_async( frames, n + 1, sram_async_done, this ) != 0 ) {
+        bus.deselect();
+        async_busy = false;
+        async_event = AD910X_EVENT_ERROR;
+        return -1;
+    }
+    return 0;
+}
+
+//  * @brief Transport completion handler: release chip select and notify the user
+//  * @param ctx - driver instance
+//  * @param event - AD910X_EVENT_* of the block transfer
+//  * @return none
+
+void AD910x_BASE::sram_async_done( void *ctx, int event ) {
+    AD910x_BASE *self = (AD910x_BASE *)ctx;
+    
+    self->bus.deselect();
+    self->async_event = event;
+    self->async_busy = false;
+    
+    if ( self->async_cb ) {
+        self->async_cb( self->async_ctx, event );
+    }
+}
+
+//  * @brief Check whether an asynchronous SRAM upload is still streaming
+//  * @param none
+//  * @return true while the block transfer runs
+
+bool AD910x_BASE::AD910x_sram_busy() {
+    return async_busy;
+}
+
+//  * @brief Wait for the asynchronous SRAM upload, then hand SRAM back to the pattern generator.
+//  *        Must be called from thread context before the next SPI access.
+//  * @param none
+//  * @return 0 on success, -1 on transfer error or if no upload was started
+
+int AD910x_BASE::AD910x_finish_sram() {
+    if ( async_mask == 0 ) {
+        return -1;
+    }
+    
+    while ( async_busy ) {
+        bus.delay_us( 1 );
+    }
+    
+    dev_write( async_mask, AD910X_REG_PAT_STATUS, 0x0000 );
+    
+    int ret = 0;
+    if ( async_event == AD910X_EVENT_COMPLETE ) {
+        uint16_t offset = async_frames[0] - AD910X_SRAM_ADDR;
+        shadow_sram( async_mask, offset, async_frames + 1, async_n );
+        stats.sram_written += async_n;
+        verify_update( async_mask, NULL, offset, offset + async_n );
+    } else {
+        AD910x_invalidate_sram();
+        ret = -1;
+    }
+    async_mask = 0;
+    
+    return ret;
+}
+
+//  * @brief Read from SRAM and print data
+//  * @param dev_mask - device to read from
+//  * @param n - number of SRAM addresses to be read from
+//  * @return none
+
+void AD910x_BASE::dev_print_sram( uint32_t dev_mask, uint16_t n ) {
+    if ( log_level == AD910X_LOG_OFF ) {
+        return;
+    }
+    
+    dev_write( dev_mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | AD910X_BUF_READ );
+    
+    int16_t data_shifted = 0;
+    uint16_t checksum = 0;
+    
+    uint16_t sram_add = AD910X_SRAM_ADDR;
+    
+    for ( int i=0; i<n; i++ ) {
+        data_shifted = dev_read( dev_mask, sram_add+i ) >> 2;
+        checksum += data_shifted;
+        log_data( sram_add+i, data_shifted );
+    }
+    
+    dev_write( dev_mask, AD910X_REG_PAT_STATUS, 0x0000 );
+    
+    if ( log_level == AD910X_LOG_SUMMARY ) {
+        printf( "SRAM 0x%04X-0x%04X read, sum 0x%04X\n", sram_add, sram_add+n-1, checksum );
+    }
+}
+
+//  * @brief Read registers and SRAM in bursts and stream them as binary dump frames
+//  *        (see ad910x_dump.h): per device one frame per run of consecutive
+//  *        registers in reg_add, SRAM in frames of AD910X_DUMP_WORDS words, then
+//  *        one END frame for the whole dump. About 2 bytes per word instead of
+//  *        16 for AD910x_print_sram.
+//  * @param dev_mask - devices to dump
+//  * @param n - number of SRAM words from 0x6000
+//  * @param write - byte sink
+//  * @param ctx - argument passed to write
+//  * @return bytes written, or -1 if write failed
+
+int32_t AD910x_BASE::dev_dump( uint32_t dev_mask, uint16_t n, AD910x_DumpWrite write, void *ctx ) {
+    uint32_t regs[AD910X_REG_SPACE / 32] = {0};
+    uint16_t words[AD910X_DUMP_WORDS];
+    uint8_t frame[AD910X_DUMP_FRAME_MAX];
+    uint32_t len;
+    int32_t total = 0;
+    uint16_t frames = 0;
+    
+    n = ( n > AD910X_SRAM_SIZE ) ? AD910X_SRAM_SIZE : n;
+    for ( int i=0; i<66; i++ ) {
+        regs[reg_add[i] / 32] |= 1u << ( reg_add[i] % 32 );
+    }
+    
+    for ( int d=0; d<num_devs; d++ ) {
+        uint32_t mask = 1u << d;
+        if ( !( dev_mask & mask ) ) {
+            continue;
+        }
+        
+        for ( uint16_t a=0; a<AD910X_REG_SPACE; ) {
+            uint16_t b = a;
+            while ( b < AD910X_REG_SPACE && ( ( regs[b / 32] >> ( b % 32 ) ) & 1 ) ) {
+                b++;
+            }
+            if ( b == a ) {
+                a++;
+                continue;
+            }
+            dev_read_block( mask, a, words, b - a );
+            len = AD910x_dump_frame( frame, AD910X_DUMP_REGS, d, a, words, b - a );
+            if ( write( ctx, frame, len ) != 0 ) {
+                return -1;
+            }
+            total += len;
+            frames++;
+            a = b;
+        }
+        
+        if ( n == 0 ) {
+            continue;
+        }
+        dev_write( mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | AD910X_BUF_READ );
+        for ( uint16_t i=0; i<n; i+=AD910X_DUMP_WORDS ) {
+            uint16_t k = ( n - i < AD910X_DUMP_WORDS ) ? n - i : AD910X_DUMP_WORDS;
+            dev_read_block( mask, AD910X_SRAM_ADDR + i, words, k );
+            len = AD910x_dump_frame( frame, AD910X_DUMP_SRAM, d, AD910X_SRAM_ADDR + i, words, k );
+            if ( write( ctx, frame, len ) != 0 ) {
+                dev_write( mask, AD910X_REG_PAT_STATUS, 0x0000 );
+                return -1;
+            }
+            total += len;
+            frames++;
+        }
+        dev_write( mask, AD910X_REG_PAT_STATUS, 0x0000 );
+    }
+    
+    len = AD910x_dump_frame( frame, AD910X_DUMP_END, 0, frames, NULL, 0 );
+    if ( write( ctx, frame, len ) != 0 ) {
+        return -1;
+    }
+    return total + len;
+}
+
+//  * @brief Write to SPI registers, and read and print new register values.
+//  *        With reg_cache_en, registers that already hold the value are not
+//  *        written or read back (their shadow value is printed), and RAMUPDATE
+//  *        is only written if another register changed. The remaining registers
+//  *        are written by dev_write_regs. Below AD910X_LOG_FULL nothing is read
+//  *        back, since the values would not be displayed.
+//  * @param dev_mask - device to write to
+//  * @param data[] - array of data to written to SPI registers
+//  * @return none
+
+void AD910x_BASE::dev_update_regs( uint32_t dev_mask, const uint16_t data[] ) {
+    uint16_t addr_set[66];
+    uint16_t data_set[66];
+    uint32_t sent[AD910X_REG_SPACE / 32] = {0};
+    uint16_t n = 0;
+    bool display = ( log_level >= AD910X_LOG_FULL );
+    uint32_t written = stats.reg_written;
+    
+    for ( int i=0; i<66; i++ ) {
+        bool skip;
+        if ( !reg_cache_en ) {
+            skip = false;
+        } else if ( reg_add[i] == AD910X_REG_RAMUPDATE ) {
+            skip = ( n == 0 );
+        } else {
+            skip = !reg_dirty( dev_mask, reg_add[i], data[i] );
+        }
+        
+        if ( !skip ) {
+            addr_set[n] = reg_add[i];
+            data_set[n++] = data[i];
+            sent[reg_add[i] / 32] |= 1u << ( reg_add[i] % 32 );
+        }
+    }
+    
+    uint32_t saved = dev_write_regs( dev_mask, addr_set, data_set, n );
+    stats.reg_skipped += 66 - ( stats.reg_written - written );
+    
+    if ( display ) {
+        for ( int i=0; i<66; i++ ) {
+            if ( ( sent[reg_add[i] / 32] >> ( reg_add[i] % 32 ) ) & 1 ) {
+                log_data( reg_add[i], dev_read( dev_mask, reg_add[i] ) );
+            } else {
+                log_data( reg_add[i], shadow[first_dev( dev_mask )].regs[reg_add[i]] );
+            }
+        }
+    }
+    
+    if ( log_level == AD910X_LOG_SUMMARY ) {
+        printf( "%u registers written, %u unchanged, %u frames saved\n", (unsigned)( stats.reg_written - written ),
+                (unsigned)( 66 - ( stats.reg_written - written ) ), (unsigned)saved );
+    }
+}
+
+//  * @brief Write a set of registers in as few transactions as possible. Registers
+//  *        are sorted by address and consecutive ones share one transaction
+//  *        (the address auto-increments). A gap of fewer than AD910X_REG_GAP
+//  *        registers is bridged by resending their shadow values, if they are
+//  *        in reg_add and known. PAT_STATUS is written next to last and
+//  *        RAMUPDATE last. Without burst_en every register gets its own transaction.
+//  * @param dev_mask - devices to write to
+//  * @param addr[] - n register addresses below AD910X_REG_SPACE, in any order
+//  * @param data[] - n register values
+//  * @param n - number of registers
+//  * @return frames saved compared to one transaction per register
+
+uint32_t AD910x_BASE::dev_write_regs( uint32_t dev_mask, const uint16_t addr[], const uint16_t data[], uint16_t n ) {
+    uint16_t val[AD910X_REG_SPACE];
+    uint32_t want[AD910X_REG_SPACE / 32] = {0};
+    uint32_t writable[AD910X_REG_SPACE / 32] = {0};
+    uint16_t run[AD910X_REG_SPACE];
+    uint16_t run_addr = 0;
+    uint16_t run_n = 0;
+    uint32_t frames = 0;
+    uint32_t words = 0;
+    
+    for ( int i=0; i<n; i++ ) {
+        val[addr[i]] = data[i];
+        want[addr[i] / 32] |= 1u << ( addr[i] % 32 );
+    }
+    for ( int i=0; i<66; i++ ) {
+        writable[reg_add[i] / 32] |= 1u << ( reg_add[i] % 32 );
+    }
+    
+    for ( uint16_t a=0; a<=AD910X_REG_SPACE; a++ ) {
+        bool last = ( a == AD910X_REG_SPACE );
+        if ( !last && ( !( ( want[a / 32] >> ( a % 32 ) ) & 1 ) || a == AD910X_REG_RAMUPDATE || a == AD910X_REG_PAT_STATUS ) ) {
+            continue;
+        }
+        
+        // * Extend the running transaction over a short gap of known registers * //
+        if ( !last && run_n != 0 && burst_en && a > run_addr + run_n && a - ( run_addr + run_n ) < AD910X_REG_GAP ) {
+            bool bridge = true;
+            for ( uint16_t g=run_addr+run_n; g<a && bridge; g++ ) {
+                bridge = ( ( writable[g / 32] >> ( g % 32 ) ) & 1 ) && g != AD910X_REG_RAMUPDATE && g != AD910X_REG_PAT_STATUS &&
+                        !reg_dirty( dev_mask, g, shadow[first_dev( dev_mask )].regs[g] );
+            }
+            for ( uint16_t g=run_addr+run_n; g<a && bridge; g++ ) {
+                run[run_n++] = shadow[first_dev( dev_mask )].regs[g];
+            }
+        }
+        
+        if ( run_n != 0 && ( last || !burst_en || a != run_addr + run_n ) ) {
+            if ( run_n == 1 ) {
+                dev_write( dev_mask, run_addr, run[0] );
+            } else {
+                bus.select( dev_mask );
+                bus.write( run_addr );
+                bus.write_block( run, run_n );
+                bus.deselect();
+                bus.delay_us( 1 );
+                for ( int i=0; i<run_n; i++ ) {
+                    shadow_reg( dev_mask, run_addr + i, run[i] );
+                }
+            }
+            frames += run_n + 1;
+            words += run_n;
+            run_n = 0;
+        }
+        
+        if ( !last ) {
+            if ( run_n == 0 ) {
+                run_addr = a;
+            }
+            run[run_n++] = val[a];
+        }
+    }
+    
+    // * Pattern control, then the update strobe that latches everything * //
+    const uint16_t tail[] = { AD910X_REG_PAT_STATUS, AD910X_REG_RAMUPDATE };
+    for ( int i=0; i<2; i++ ) {
+        if ( ( want[tail[i] / 32] >> ( tail[i] % 32 ) ) & 1 ) {
+            dev_write( dev_mask, tail[i], val[tail[i]] );
+            frames += 2;
+            words++;
+        }
+    }
+    
+    stats.reg_written += words;
+    uint32_t saved = ( 2 * words > frames ) ? 2 * words - frames : 0;
+    stats.reg_frames_saved += saved;
+    verify_update( dev_mask, want, 0, 0 );
+    return saved;
+}
+
+//  * @brief Write the digital gains and offsets of a batch. With reg_cache_en
+//  *        only values that differ from the shadow are sent. DACx_DOF and
+//  *        DACx_DGAIN are each consecutive, so the changes of all channels
+//  *        take at most two transactions, followed by one RAMUPDATE that
+//  *        latches them together.
+//  * @param dev_mask - devices to write to
+//  * @param batch - channels and values to change
+//  * @return gain/offset registers written (0 sends nothing), -1 if a value
+//  *         does not fit in 12 bits
+
+int AD910x_BASE::dev_update_channels( uint32_t dev_mask, const AD910x_ChannelBatch &batch ) {
+    uint16_t addr[2 * AD910X_CHANNELS + 1];
+    uint16_t data[2 * AD910X_CHANNELS + 1];
+    uint16_t n = 0;
+    
+    // * Check every value first, so a rejected batch leaves the devices and the statistics alone * //
+    for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+        for ( int k=0; k<2; k++ ) {
+            bool set = ( ( k ? batch.offset_set : batch.gain_set ) >> ch ) & 1;
+            int16_t value = k ? batch.offset[ch] : batch.gain[ch];
+            if ( set && ( value < -2048 || value > 2047 ) ) {
+                return -1;
+            }
+        }
+    }
+    
+    for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+        for ( int k=0; k<2; k++ ) {
+            bool set = ( ( k ? batch.offset_set : batch.gain_set ) >> ch ) & 1;
+            int16_t value = k ? batch.offset[ch] : batch.gain[ch];
+            if ( !set ) {
+                continue;
+            }
+            uint16_t reg = k ? AD910X_REG_DOF( ch ) : AD910X_REG_DGAIN( ch );
+            uint16_t word = (uint16_t)( (uint16_t)value << AD910X_CHAN_SHIFT );
+            if ( reg_cache_en && !reg_dirty( dev_mask, reg, word ) ) {
+                stats.reg_skipped++;
+                continue;
+            }
+            addr[n] = reg;
+            data[n++] = word;
+        }
+    }
+    if ( n == 0 ) {
+        return 0;
+    }
+    
+    addr[n] = AD910X_REG_RAMUPDATE;
+    data[n] = 0x0001;
+    dev_write_regs( dev_mask, addr, data, n + 1 );
+    return n;
+}
+
+//  * @brief Check a register value against the shadow
+//  * @param dev_mask - devices to check
+//  * @param addr - SPI register address
+//  * @param data - new register value
+//  * @return true if any device in dev_mask may hold a different value
+
+bool AD910x_BASE::reg_dirty( uint32_t dev_mask, uint16_t addr, uint16_t data ) {
+    for ( int d=0; d<num_devs; d++ ) {
+        if ( !( dev_mask & ( 1u << d ) ) ) {
+            continue;
+        }
+        if ( !( ( shadow[d].reg_known[addr / 32] >> ( addr % 32 ) ) & 1 ) || shadow[d].regs[addr] != data ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//  * @brief Copy a written register value into the shadow. RAMUPDATE self-clears and is not cached.
+//  * @param dev_mask - devices written to
+//  * @param addr - SPI register address
+//  * @param data - register value
+//  * @return none
+
+void AD910x_BASE::shadow_reg( uint32_t dev_mask, uint16_t addr, uint16_t data ) {
+    if ( addr >= AD910X_REG_SPACE || addr == AD910X_REG_RAMUPDATE ) {
+        return;
+    }
+    for ( int d=0; d<num_devs; d++ ) {
+        if ( dev_mask & ( 1u << d ) ) {
+            shadow[d].regs[addr] = data;
+            shadow[d].reg_known[addr / 32] |= 1u << ( addr % 32 );
+        }
+    }
+}
+
+int AD910x_BASE::first_dev( uint32_t dev_mask ) {
+    int d = 0;
+    while ( d < num_devs - 1 && !( dev_mask & ( 1u << d ) ) ) {
+        d++;
+    }
+    return d;
+}
+
+// ********************************************************* //
+// SPI FUNCTIONS 
+// ********************************************************* //
+
+//  * @brief Set AD910x SPI word length, mode, frequency
+//  * @param reg_len - SPI word length
+//  * @param mode - SPI clock polarity, clock and data phase
+//  * @param hz - SPI bus frequency in hz
+//  * @return none
+
+void AD910x_BASE::spi_init( uint8_t reg_len, uint8_t mode, uint32_t hz ) {
+    bus.format( reg_len, mode );
+    bus.frequency( hz );
+    bus.deselect();
+}
+
+//  * @brief Train the SPI clock: starting at max_hz, halve the clock (one
+//  *        prescaler step) until every device passes AD910X_TRAIN_ROUNDS rounds
+//  *        of test patterns. The fastest passing clock is only the edge of the
+//  *        link at the current temperature and wiring; the clock in effect is
+//  *        one step below it, if that step passes too and is not below
+//  *        AD910X_TRAIN_MIN_HZ. Call after AD910x_reg_reset(); uses the last
+//  *        AD910X_BURST_CHUNK SRAM words and PAT_PERIOD (see link_test).
+//  * @param max_hz - fastest SPI clock to try
+//  * @return SPI clock in effect, 0 if no clock down to AD910X_TRAIN_MIN_HZ passed
+
+uint32_t AD910x_BASE::AD910x_train_spi( uint32_t max_hz ) {
+    spi_hz = 0;
+    spi_edge_hz = 0;
+    spi_max_hz = max_hz;
+    
+    for ( uint32_t hz=max_hz; hz>=AD910X_TRAIN_MIN_HZ; hz/=2 ) {
+        bus.frequency( hz );
+        if ( !link_test( AD910X_TRAIN_ROUNDS ) ) {
+            continue;
+        }
+        uint32_t actual = bus.get_frequency() ? bus.get_frequency() : hz;
+        if ( spi_edge_hz == 0 ) {
+            spi_edge_hz = actual;
+            if ( hz / 2 >= AD910X_TRAIN_MIN_HZ ) {
+                continue;
+            }
+        }
+        spi_hz = actual;
+        break;
+    }
+    
+    if ( spi_hz == 0 && spi_edge_hz != 0 ) {
+        // * Nothing below the edge passed: run at the edge rather than not at all * //
+        bus.frequency( spi_edge_hz );
+        spi_hz = spi_edge_hz;
+    } else if ( spi_hz == 0 ) {
+        bus.frequency( AD910X_TRAIN_MIN_HZ );
+    }
+    if ( log_level != AD910X_LOG_OFF ) {
+        if ( spi_hz != 0 ) {
+            printf( "SPI clock trained to %u Hz (fastest passing %u Hz)\n", (unsigned)spi_hz, (unsigned)spi_edge_hz );
+        } else {
+            printf( "SPI link failed down to %u Hz\n", (unsigned)AD910X_TRAIN_MIN_HZ );
+        }
+    }
+    return spi_hz;
+}
+
+//  * @brief Run one round of the link test at the trained clock. On failure,
+//  *        train again starting one prescaler step lower. Without a usable
+//  *        clock (training failed, or no step is left below the trained one)
+//  *        training starts over at the clock of the last AD910x_train_spi, so
+//  *        the link recovers once the fault clears. A running pattern keeps
+//  *        running: the test words are restored from the shadow afterwards,
+//  *        but the output pauses while the test holds MEM_ACCESS.
+//  * @param none
+//  * @return 0 if the link is good, 1 if it was re-trained, -1 if no clock passes
+
+int AD910x_BASE::AD910x_check_link() {
+    if ( spi_hz != 0 && link_test( 1 ) ) {
+        return 0;
+    }
+    uint32_t max_hz = spi_max_hz ? spi_max_hz : bus.get_frequency();
+    uint32_t from = ( spi_hz == 0 || spi_hz / 2 < AD910X_TRAIN_MIN_HZ ) ? max_hz : spi_hz / 2;
+    uint32_t hz = AD910x_train_spi( from );
+    spi_max_hz = max_hz;
+    return hz ? 1 : -1;
+}
+
+//  * @brief Write test patterns to PAT_PERIOD and to the last SRAM block of every
+//  *        device and read them back. Afterwards PAT_PERIOD and the SRAM words
+//  *        the shadow knows are written back and PAT_STATUS is restored, RUN
+//  *        included; words the shadow does not know, and all of them after a
+//  *        failed test, are marked unknown.
+//  * @param rounds - passes of all patterns
+//  * @return true if every word read back matched
+
+bool AD910x_BASE::link_test( int rounds ) {
+    static const uint16_t patterns[] = { 0x0000, 0xFFFF, 0xAAAA, 0x5555, 0x8001, 0x7FFE, 0xF0F0, 0x0F0F };
+    const uint16_t offset = AD910X_SRAM_SIZE - AD910X_BURST_CHUNK;
+    const uint16_t reg = AD910X_REG_PAT_PERIOD;
+    uint16_t frames[AD910X_BURST_CHUNK];
+    uint16_t back[AD910X_BURST_CHUNK];
+    bool pass = true;
+    
+    for ( int d=0; d<num_devs && pass; d++ ) {
+        uint32_t mask = 1u << d;
+        uint16_t saved = shadow[d].regs[reg];
+        bool known = ( shadow[d].reg_known[reg / 32] >> ( reg % 32 ) ) & 1;
+        uint16_t status;
+        if ( ( shadow[d].reg_known[AD910X_REG_PAT_STATUS / 32] >> ( AD910X_REG_PAT_STATUS % 32 ) ) & 1 ) {
+            status = shadow[d].regs[AD910X_REG_PAT_STATUS];
+        } else {
+            status = dev_read( mask, AD910X_REG_PAT_STATUS );
+        }
+        uint16_t run = status & AD910X_PAT_RUN;
+        
+        for ( int r=0; r<rounds && pass; r++ ) {
+            for ( size_t p=0; p<sizeof( patterns )/sizeof( patterns[0] ) && pass; p++ ) {
+                dev_write( mask, reg, patterns[p] );
+                pass = (uint16_t)dev_read( mask, reg ) == patterns[p];
+            }
+            
+            // * Alternating patterns with a walking bit, in the 14-bit SRAM field * //
+            for ( int i=0; i<AD910X_BURST_CHUNK; i++ ) {
+                uint16_t base = ( i & 1 ) ? 0xAAAA : 0x5555;
+                frames[i] = ( base ^ ( 1u << ( ( i + r ) % 16 ) ) ) & 0xFFFC;
+            }
+            dev_write( mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | run );
+            bus.select( mask );
+            bus.write( AD910X_SRAM_ADDR + offset );
+            bus.write_block( frames, AD910X_BURST_CHUNK );
+            bus.deselect();
+            bus.delay_us( 1 );
+            dev_write( mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | AD910X_BUF_READ | run );
+            dev_read_block( mask, AD910X_SRAM_ADDR + offset, back, AD910X_BURST_CHUNK );
+            pass = pass && memcmp( frames, back, sizeof( frames ) ) == 0;
+        }
+        
+        if ( known ) {
+            dev_write( mask, reg, saved );
+        } else {
+            shadow[d].reg_known[reg / 32] &= ~( 1u << ( reg % 32 ) );
+        }
+        // * Put back the words the shadow knows, one burst per known run * //
+        dev_write( mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | run );
+        for ( int i=offset; i<AD910X_SRAM_SIZE; ) {
+            int n = 0;
+            while ( pass && i + n < AD910X_SRAM_SIZE && ( ( shadow[d].sram_known[( i + n ) / 32] >> ( ( i + n ) % 32 ) ) & 1 ) ) {
+                frames[n] = shadow[d].sram[i + n];
+                n++;
+            }
+            if ( n == 0 ) {
+                shadow[d].sram_known[i / 32] &= ~( 1u << ( i % 32 ) );
+                i++;
+                continue;
+            }
+            bus.select( mask );
+            bus.write( AD910X_SRAM_ADDR + i );
+            bus.write_block( frames, n );
+            bus.deselect();
+            bus.delay_us( 1 );
+            i += n;
+        }
+        dev_write( mask, AD910X_REG_PAT_STATUS, status );
+    }
+    
+    if ( !pass ) {
+        stats.link_errors++;
+    }
+    return pass;
+}
+
+//  * @brief Write 16-bit data to AD910x SPI/SRAM register
+//  * @param dev_mask - devices to write to
+//  * @param addr - SPI/SRAM address
+//  * @param data - data to be written to register address
+//  * @return none
+
+void AD910x_BASE::dev_write( uint32_t dev_mask, uint16_t addr, int16_t data ) {
+    bus.select( dev_mask );
+    
+    bus.write( addr );
+    bus.write( data );
+    
+    bus.deselect();
+    bus.delay_us( 1 );
+    
+    shadow_reg( dev_mask, addr, data );
+}
+
+//  * @brief Read 16-bit data from AD910x SPI/SRAM register
+//  * @param dev_mask - device to read from
+//  * @param addr - SPI/SRAM address
+//  * @return reg_data - data returned by AD910x
+
+int16_t AD910x_BASE::dev_read( uint32_t dev_mask, uint16_t addr ) {
+    uint16_t read_addr;
+    int16_t reg_data;
+    
+    // * Devices share MISO: read one at a time * //
+    bus.select( 1u << first_dev( dev_mask ) );
+    
+    read_addr = AD910X_SPI_READ + addr;
+    bus.write( read_addr );
+    reg_data = bus.write( 0 );
+    
+    bus.deselect();
+    bus.delay_us( 1 );
+    
+    return reg_data;
+}
+
+//  * @brief Read n consecutive registers/SRAM words in one transaction
+//  * @param dev_mask - device to read from (lowest device in the mask)
+//  * @param addr - first SPI/SRAM address
+//  * @param data[] - n words read
+//  * @param n - number of words
+//  * @return none
+
+void AD910x_BASE::dev_read_block( uint32_t dev_mask, uint16_t addr, uint16_t data[], uint16_t n ) {
+    bus.select( 1u << first_dev( dev_mask ) );
+    bus.write( AD910X_SPI_READ + addr );
+    for ( int i=0; i<n; i++ ) {
+        data[i] = bus.write( 0 );
+    }
+    bus.deselect();
+    bus.delay_us( 1 );
+}
+
+//  * @brief Read SRAM words for a caller that does not own the pattern, e.g. a
+//  *        queued or host read. PAT_STATUS is taken from the shadow (or the
+//  *        device if the shadow does not know it) and written back afterwards,
+//  *        so a read during playback leaves RUN set.
+//  * @param dev_mask - device to read from (lowest device in the mask)
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param data[] - n words read, in wire format
+//  * @param n - number of words
+//  * @return none
+
+void AD910x_BASE::dev_read_sram( uint32_t dev_mask, uint16_t offset, uint16_t data[], uint16_t n ) {
+    int d = first_dev( dev_mask );
+    uint32_t one = 1u << d;
+    uint16_t status;
+    
+    if ( ( shadow[d].reg_known[AD910X_REG_PAT_STATUS / 32] >> ( AD910X_REG_PAT_STATUS % 32 ) ) & 1 ) {
+        status = shadow[d].regs[AD910X_REG_PAT_STATUS];
+    } else {
+        status = dev_read( one, AD910X_REG_PAT_STATUS );
+    }
+    dev_write( one, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | AD910X_BUF_READ | ( status & AD910X_PAT_RUN ) );
+    dev_read_block( one, AD910X_SRAM_ADDR + offset, data, n );
+    dev_write( one, AD910X_REG_PAT_STATUS, status );
+}
+
+//  * @brief Read back registers and SRAM words and compare them to the shadow.
+//  *        Consecutive registers and SRAM words are read in one transaction;
+//  *        words the shadow does not know, RAMUPDATE and PAT_STATUS are skipped.
+//  * @param dev_mask - devices to check
+//  * @param regs[] - bitmap of register addresses to check, NULL for none
+//  * @param lo - first SRAM word to check (0 = 0x6000)
+//  * @param hi - SRAM word after the last one to check; lo >= hi checks no SRAM
+//  * @param step - check every step-th SRAM word; above 1 each word is read on its own
+//  * @return verify_result
+
+const AD910x_VerifyResult &AD910x_BASE::dev_verify( uint32_t dev_mask, const uint32_t regs[], uint16_t lo, uint16_t hi, uint16_t step ) {
+    uint16_t back[AD910X_BURST_CHUNK];
+    memset( &verify_result, 0, sizeof( verify_result ) );
+    
+    for ( int d=0; d<num_devs; d++ ) {
+        uint32_t mask = 1u << d;
+        if ( !( dev_mask & mask ) ) {
+            continue;
+        }
+        
+        for ( uint16_t a=0; regs != NULL && a<AD910X_REG_SPACE; ) {
+            uint16_t b = a;
+            while ( b < AD910X_REG_SPACE && b - a < AD910X_BURST_CHUNK && ( ( regs[b / 32] >> ( b % 32 ) ) & 1 ) &&
+                    ( ( shadow[d].reg_known[b / 32] >> ( b % 32 ) ) & 1 ) &&
+                    b != AD910X_REG_RAMUPDATE && b != AD910X_REG_PAT_STATUS ) {
+                b++;
+            }
+            if ( b == a ) {
+                a++;
+                continue;
+            }
+            dev_read_block( mask, a, back, b - a );
+            for ( uint16_t r=a; r<b; r++ ) {
+                verify_word( d, r, shadow[d].regs[r], back[r - a] );
+            }
+            a = b;
+        }
+        
+        if ( lo >= hi ) {
+            continue;
+        }
+        dev_write( mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | AD910X_BUF_READ );
+        if ( step <= 1 ) {
+            for ( uint16_t i=lo; i<hi; i+=AD910X_BURST_CHUNK ) {
+                uint16_t n = ( hi - i < AD910X_BURST_CHUNK ) ? hi - i : AD910X_BURST_CHUNK;
+                dev_read_block( mask, AD910X_SRAM_ADDR + i, back, n );
+                for ( uint16_t j=0; j<n; j++ ) {
+                    if ( ( shadow[d].sram_known[( i + j ) / 32] >> ( ( i + j ) % 32 ) ) & 1 ) {
+                        verify_word( d, AD910X_SRAM_ADDR + i + j, shadow[d].sram[i + j], back[j] );
+                    }
+                }
+            }
+        } else {
+            for ( uint32_t i=lo; i<hi; i+=step ) {
+                if ( ( shadow[d].sram_known[i / 32] >> ( i % 32 ) ) & 1 ) {
+                    verify_word( d, AD910X_SRAM_ADDR + i, shadow[d].sram[i], dev_read( mask, AD910X_SRAM_ADDR + i ) );
+                }
+            }
+        }
+        dev_write( mask, AD910X_REG_PAT_STATUS, 0x0000 );
+    }
+    
+    return verify_result;
+}
+
+//  * @brief Check every known register and SRAM word against the shadow
+//  * @param dev_mask - devices to check
+//  * @param mode - AD910X_VERIFY_SAMPLED checks every verify_step-th SRAM word,
+//  *               FINAL and FULL check all of them, NONE reads nothing
+//  * @return verify_result
+
+const AD910x_VerifyResult &AD910x_BASE::dev_check( uint32_t dev_mask, uint8_t mode ) {
+    uint32_t regs[AD910X_REG_SPACE / 32] = {0};
+    
+    if ( mode == AD910X_VERIFY_NONE ) {
+        memset( &verify_result, 0, sizeof( verify_result ) );
+        return verify_result;
+    }
+    for ( int i=0; i<66; i++ ) {
+        regs[reg_add[i] / 32] |= 1u << ( reg_add[i] % 32 );
+    }
+    return dev_verify( dev_mask, regs, 0, AD910X_SRAM_SIZE, ( mode == AD910X_VERIFY_SAMPLED ) ? verify_step : 1 );
+}
+
+//  * @brief Read back according to verify_mode after an update
+//  * @param dev_mask - devices updated
+//  * @param regs[] - bitmap of registers written, NULL for none
+//  * @param lo - first SRAM word written
+//  * @param hi - SRAM word after the last one written
+//  * @return none
+
+void AD910x_BASE::verify_update( uint32_t dev_mask, const uint32_t regs[], uint16_t lo, uint16_t hi ) {
+    if ( verify_mode == AD910X_VERIFY_NONE ) {
+        return;
+    }
+    if ( verify_mode == AD910X_VERIFY_FULL ) {
+        dev_check( dev_mask, AD910X_VERIFY_FULL );
+    } else {
+        dev_verify( dev_mask, regs, lo, hi, ( verify_mode == AD910X_VERIFY_SAMPLED ) ? verify_step : 1 );
+    }
+}
+
+//  * @brief Count one compared word and record it if it differs
+//  * @param dev - device index
+//  * @param addr - SPI/SRAM address
+//  * @param expected - shadow value
+//  * @param actual - value read back
+//  * @return none
+
+void AD910x_BASE::verify_word( uint8_t dev, uint16_t addr, uint16_t expected, uint16_t actual ) {
+    verify_result.checked++;
+    if ( expected == actual ) {
+        return;
+    }
+    if ( verify_result.recorded < AD910X_VERIFY_KEEP ) {
+        AD910x_Mismatch &m = verify_result.mismatch[verify_result.recorded++];
+        m.dev = dev;
+        m.addr = addr;
+        m.expected = expected;
+        m.actual = actual;
+    }
+    verify_result.mismatches++;
+}
+
+//  * @brief Read back every device in dev_mask and compare it to the lowest one
+//  * @param dev_mask - devices to compare
+//  * @param sram - also compare all SRAM words
+//  * @return number of registers and SRAM words that differ, summed over devices
+
+int AD910x_BASE::dev_verify_match( uint32_t dev_mask, bool sram ) {
+    uint16_t ref[AD910X_BURST_CHUNK];
+    uint16_t val[AD910X_BURST_CHUNK];
+    int ref_dev = first_dev( dev_mask );
+    int mismatches = 0;
+    
+    for ( int i=0; i<66; i++ ) {
+        if ( reg_add[i] == AD910X_REG_RAMUPDATE ) {
+            continue;
+        }
+        uint16_t data = dev_read( 1u << ref_dev, reg_add[i] );
+        for ( int d=ref_dev+1; d<num_devs; d++ ) {
+            if ( ( dev_mask & ( 1u << d ) ) && (uint16_t)dev_read( 1u << d, reg_add[i] ) != data ) {
+                mismatches++;
+            }
+        }
+    }
+    
+    if ( sram ) {
+        dev_write( dev_mask, AD910X_REG_PAT_STATUS, AD910X_MEM_ACCESS | AD910X_BUF_READ );
+        for ( int i=0; i<AD910X_SRAM_SIZE; i+=AD910X_BURST_CHUNK ) {
+            dev_read_block( 1u << ref_dev, AD910X_SRAM_ADDR + i, ref, AD910X_BURST_CHUNK );
+            for ( int d=ref_dev+1; d<num_devs; d++ ) {
+                if ( !( dev_mask & ( 1u << d ) ) ) {
+                    continue;
+                }
+                dev_read_block( 1u << d, AD910X_SRAM_ADDR + i, val, AD910X_BURST_CHUNK );
+                for ( int j=0; j<AD910X_BURST_CHUNK; j++ ) {
+                    mismatches += ( val[j] != ref[j] );
+                }
+            }
+        }
+        dev_write( dev_mask, AD910X_REG_PAT_STATUS, 0x0000 );
+    }
+    
+    return mismatches;
+}
+#pragma endregion
+
+#pragma region (SINGLE-BOARD CODE)
+AD910x_SINGLE::AD910x_SINGLE( AD910x_Transport &spi_bus ) : AD910x_BASE( spi_bus, dev_shadow, 1 ) {
+}
+
+//  * @brief Write data to SRAM
+//  * @param data[] - array of data to be written to SRAM
+//  * @return 0 on success, -1 if an upload is open
+
+int AD910x_SINGLE::AD910x_update_sram( const int16_t data[] ) { 
+    return dev_update_sram( 0x1, data );
+}
+
+//  * @brief Write n words to SRAM, starting at offset
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @param data[] - n samples
+//  * @return 0 on success, -1 if the range does not fit in SRAM
+
+int AD910x_SINGLE::AD910x_update_sram_range( uint16_t offset, uint16_t n, const int16_t data[] ) {
+    return dev_update_sram_range( 0x1, offset, n, data );
+}
+
+//  * @brief Write only the SRAM words played by a register set
+//  * @param image[] - full SRAM image of 4096 samples
+//  * @param regval[] - register values that will be applied with AD910x_update_regs
+//  * @return number of SRAM words in the played ranges
+
+int AD910x_SINGLE::AD910x_update_sram_used( const int16_t image[], const uint16_t regval[] ) {
+    return dev_update_sram_used( 0x1, image, regval );
+}
+
+//  * @brief Open an SRAM upload fed piecewise, e.g. while a waveform arrives from
+//  *        the host; no other SPI access until AD910x_stream_end()
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @return 0 on success, -1 if the range does not fit or an upload is open
+
+int AD910x_SINGLE::AD910x_stream_begin( uint16_t offset, uint16_t n ) {
+    return sram_stream_begin( 0x1, offset, n );
+}
+
+//  * @brief Decode a packed waveform into SRAM
+//  * @param wave - packed waveform (see AD910x_pack_wave)
+//  * @return 0 on success, -1 if the packed data is corrupt
+
+int AD910x_SINGLE::AD910x_update_sram_packed( const AD910x_PackedWave &wave ) {
+    return dev_update_sram_packed( 0x1, wave );
+}
+
+//  * @brief Write prepared frames to SRAM in the background (see AD910x_prepare_sram)
+//  * @param frames[] - n+1 frames; must stay valid until the upload completes
+//  * @param n - number of data words
+//  * @param cb - optional completion callback, may run in interrupt context
+//  * @param ctx - argument passed to cb
+//  * @return 0 if the upload started
+
+int AD910x_SINGLE::AD910x_update_sram_async( const uint16_t frames[], uint16_t n, AD910x_Callback cb, void *ctx ) {
+    return dev_update_sram_async( 0x1, frames, n, cb, ctx );
+}
+
+//  * @brief Read from SRAM and print data
+//  * @param n - number of SRAM addresses to be read from
+//  * @return none
+
+void AD910x_SINGLE::AD910x_print_sram( uint16_t n ) {
+    dev_print_sram( 0x1, n );
+}
+
+//  * @brief Stream registers and SRAM as framed binary, e.g. to a UART at a higher baud rate
+//  * @param n - number of SRAM words from 0x6000
+//  * @param write - byte sink
+//  * @param ctx - argument passed to write
+//  * @return bytes written, or -1 if write failed
+
+int32_t AD910x_SINGLE::AD910x_dump( uint16_t n, AD910x_DumpWrite write, void *ctx ) {
+    return dev_dump( 0x1, n, write, ctx );
+}
+
+//  * @brief Write to SPI registers, and read and print new register values
+//  * @param data[] - array of data to written to SPI registers
+//  * @return none
+
+void AD910x_SINGLE::AD910x_update_regs( const uint16_t data[] ) {
+    dev_update_regs( 0x1, data );
+}
+
+//  * @brief Write a set of registers, coalescing consecutive addresses into one
+//  *        transaction; RAMUPDATE, if in the set, is written last
+//  * @param addr[] - register addresses
+//  * @param data[] - register values
+//  * @param n - number of registers
+//  * @return frames saved compared to one transaction per register
+
+uint32_t AD910x_SINGLE::AD910x_write_regs( const uint16_t addr[], const uint16_t data[], uint16_t n ) {
+    return dev_write_regs( 0x1, addr, data, n );
+}
+
+//  * @brief Change the digital gain and offset of several channels, writing
+//  *        only the changed registers and one RAMUPDATE (see dev_update_channels)
+//  * @param batch - channels and values to change
+//  * @return gain/offset registers written, -1 if a value does not fit in 12 bits
+
+int AD910x_SINGLE::AD910x_update_channels( const AD910x_ChannelBatch &batch ) {
+    return dev_update_channels( 0x1, batch );
+}
+
+//  * @brief Read back registers and SRAM and compare them to what the driver wrote
+//  * @param mode - AD910X_VERIFY_SAMPLED checks every verify_step-th SRAM word,
+//  *               FINAL and FULL check all of them
+//  * @return mismatches found, also kept in verify_result
+
+const AD910x_VerifyResult &AD910x_SINGLE::AD910x_verify( uint8_t mode ) {
+    return dev_check( 0x1, mode );
+}
+
+//  * @brief Write 16-bit data to AD910x SPI/SRAM register
+//  * @param addr - SPI/SRAM address
+//  * @param data - data to be written to register address
+//  * @return none
+
+void AD910x_SINGLE::spi_write( uint16_t addr, int16_t data ) {
+    dev_write( 0x1, addr, data );
+}
+
+//  * @brief Read 16-bit data from AD910x SPI/SRAM register
+//  * @param addr - SPI/SRAM address
+//  * @return reg_data - data returned by AD910x
+
+int16_t AD910x_SINGLE::spi_read( uint16_t addr ) {
+    return dev_read( 0x1, addr );
+}
+#pragma endregion
+
+#pragma region (MULTI-BOARD CODE)
+AD910x_MULTI::AD910x_MULTI( AD910x_Transport &spi_bus ) : AD910x_BASE( spi_bus, dev_shadow, 2 ) {
+}
+
+//  * @brief Write data to SRAM
+//  * @param devnum - device to write to
+//  * @param data[] - array of data to be written to SRAM
+//  * @return 0 on success, -1 if an upload is open
+
+int AD910x_MULTI::AD910x_update_sram( bool devnum, const int16_t data[] ) {
+    return dev_update_sram( 1u << devnum, data );
+}
+
+//  * @brief Write n words to SRAM, starting at offset
+//  * @param devnum - device to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @param data[] - n samples
+//  * @return 0 on success, -1 if the range does not fit in SRAM
+
+int AD910x_MULTI::AD910x_update_sram_range( bool devnum, uint16_t offset, uint16_t n, const int16_t data[] ) {
+    return dev_update_sram_range( 1u << devnum, offset, n, data );
+}
+
+//  * @brief Write only the SRAM words played by a register set
+//  * @param devnum - device to write to
+//  * @param image[] - full SRAM image of 4096 samples
+//  * @param regval[] - register values that will be applied with AD910x_update_regs
+//  * @return number of SRAM words in the played ranges
+
+int AD910x_MULTI::AD910x_update_sram_used( bool devnum, const int16_t image[], const uint16_t regval[] ) {
+    return dev_update_sram_used( 1u << devnum, image, regval );
+}
+
+//  * @brief Open an SRAM upload fed piecewise, e.g. while a waveform arrives from
+//  *        the host; no other SPI access until AD910x_stream_end()
+//  * @param devnum - device to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param n - number of words
+//  * @return 0 on success, -1 if the range does not fit or an upload is open
+
+int AD910x_MULTI::AD910x_stream_begin( bool devnum, uint16_t offset, uint16_t n ) {
+    return sram_stream_begin( 1u << devnum, offset, n );
+}
+
+//  * @brief Decode a packed waveform into SRAM
+//  * @param devnum - device to write to
+//  * @param wave - packed waveform (see AD910x_pack_wave)
+//  * @return 0 on success, -1 if the packed data is corrupt
+
+int AD910x_MULTI::AD910x_update_sram_packed( bool devnum, const AD910x_PackedWave &wave ) {
+    return dev_update_sram_packed( 1u << devnum, wave );
+}
+
+//  * @brief Write prepared frames to SRAM in the background (see AD910x_prepare_sram)
+//  * @param devnum - device to write to
+//  * @param frames[] - n+1 frames; must stay valid until the upload completes
+//  * @param n - number of data words
+//  * @param cb - optional completion callback, may run in interrupt context
+//  * @param ctx - argument passed to cb
+//  * @return 0 if the upload started
+
+int AD910x_MULTI::AD910x_update_sram_async( bool devnum, const uint16_t frames[], uint16_t n, AD910x_Callback cb, void *ctx ) {
+    return dev_update_sram_async( 1u << devnum, frames, n, cb, ctx );
+}
+
+//  * @brief Read from SRAM and print data
+//  * @param devnum - device to read from
+//  * @param n - number of SRAM addresses to be read from
+//  * @return none
+
+void AD910x_MULTI::AD910x_print_sram( bool devnum, uint16_t n ) {
+    dev_print_sram( 1u << devnum, n );
+}
+
+//  * @brief Stream registers and SRAM as framed binary, e.g. to a UART at a higher baud rate
+//  * @param devnum - device to dump
+//  * @param n - number of SRAM words from 0x6000
+//  * @param write - byte sink
+//  * @param ctx - argument passed to write
+//  * @return bytes written, or -1 if write failed
+
+int32_t AD910x_MULTI::AD910x_dump( bool devnum, uint16_t n, AD910x_DumpWrite write, void *ctx ) {
+    return dev_dump( 1u << devnum, n, write, ctx );
+}
+
+//  * @brief Write to SPI registers, and read and print new register values
+//  * @param devnum - device to write to
+//  * @param data[] - array of data to written to SPI registers
+//  * @return none
+
+void AD910x_MULTI::AD910x_update_regs( bool devnum, const uint16_t data[] ) {  
+    dev_update_regs( 1u << devnum, data );
+}
+
+//  * @brief Write a set of registers, coalescing consecutive addresses into one
+//  *        transaction; RAMUPDATE, if in the set, is written last
+//  * @param devnum - device to write to
+//  * @param addr[] - register addresses
+//  * @param data[] - register values
+//  * @param n - number of registers
+//  * @return frames saved compared to one transaction per register
+
+uint32_t AD910x_MULTI::AD910x_write_regs( bool devnum, const uint16_t addr[], const uint16_t data[], uint16_t n ) {
+    return dev_write_regs( 1u << devnum, addr, data, n );
+}
+
+//  * @brief Change the digital gain and offset of several channels of one device
+//  *        (see dev_update_channels)
+//  * @param devnum - device to write to
+//  * @param batch - channels and values to change
+//  * @return gain/offset registers written, -1 if a value does not fit in 12 bits
+
+int AD910x_MULTI::AD910x_update_channels( bool devnum, const AD910x_ChannelBatch &batch ) {
+    return dev_update_channels( 1u << devnum, batch );
+}
+
+//  * @brief Read back registers and SRAM and compare them to what the driver wrote
+//  * @param devnum - device to check
+//  * @param mode - AD910X_VERIFY_SAMPLED checks every verify_step-th SRAM word,
+//  *               FINAL and FULL check all of them
+//  * @return mismatches found, also kept in verify_result
+
+const AD910x_VerifyResult &AD910x_MULTI::AD910x_verify( bool devnum, uint8_t mode ) {
+    return dev_check( 1u << devnum, mode );
+}
+
+//  * @brief Write data to SRAM of both devices at once
+//  * @param data[] - array of data to be written to SRAM
+//  * @return 0 on success, -1 if an upload is open
+
+int AD910x_MULTI::AD910x_update_sram_all( const int16_t data[] ) {
+    return dev_update_sram( 0x3, data );
+}
+
+//  * @brief Decode a packed waveform into SRAM of both devices at once
+//  * @param wave - packed waveform (see AD910x_pack_wave)
+//  * @return 0 on success, -1 if the packed data is corrupt
+
+int AD910x_MULTI::AD910x_update_sram_packed_all( const AD910x_PackedWave &wave ) {
+    return dev_update_sram_packed( 0x3, wave );
+}
+
+//  * @brief Write the same SPI registers to both devices at once. Registers are
+//  *        skipped only if both devices already hold the value; displayed values
+//  *        are read from device 1.
+//  * @param data[] - array of data to written to SPI registers
+//  * @return none
+
+void AD910x_MULTI::AD910x_update_regs_all( const uint16_t data[] ) {
+    dev_update_regs( 0x3, data );
+}
+
+//  * @brief Read back both devices and compare them
+//  * @param sram - also compare the SRAM contents
+//  * @return number of registers and SRAM words that differ
+
+int AD910x_MULTI::AD910x_verify_match( bool sram ) {
+    return dev_verify_match( 0x3, sram );
+}
+
+void AD910x_MULTI::spi_en_dev( bool dev_id ) {
+    bus.select( 1u << dev_id );
+}
+
+void AD910x_MULTI::spi_disable_dev() {
+    bus.deselect();
+}
+
+//  * @brief Write 16-bit data to AD910x SPI/SRAM register
+//  * @param dev_id - device to write to
+//  * @param addr - SPI/SRAM address
+//  * @param data - data to be written to register address
+//  * @return none
+
+void AD910x_MULTI::spi_write( bool dev_id, uint16_t addr, int16_t data ) {
+    dev_write( 1u << dev_id, addr, data );
+}
+
+//  * @brief Write 16-bit data to the same AD910x SPI/SRAM register of both devices
+//  * @param addr - SPI/SRAM address
+//  * @param data - data to be written to register address
+//  * @return none
+
+void AD910x_MULTI::spi_write_all( uint16_t addr, int16_t data ) {
+    dev_write( 0x3, addr, data );
+}
+
+//  * @brief Read 16-bit data from AD910x SPI/SRAM register
+//  * @param dev_id - device to read from
+//  * @param addr - SPI/SRAM address
+//  * @return reg_data - data returned by AD910x
+
+int16_t AD910x_MULTI::spi_read( bool dev_id, uint16_t addr ) {
+    return dev_read( 1u << dev_id, addr );
+}
+#pragma endregion
@@ -1,124 +1,501 @@
-/******************************************************************************
-    @file:  ad910x.h
- 
-    @brief: Defines digital pins and functions for the devices' SPI interface
-            and printing data from SPI read to text-based user interface
--------------------------------------------------------------------------------
-    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
-    This software is proprietary to Analog Devices, Inc. and its licensors.
-
-    Licensed under the Apache License, Version 2.0 (the "License");
-    you may not use this file except in compliance with the License.
-
-    Unless required by applicable law or agreed to in writing, software
-    distributed under the License is distributed on an "AS IS" BASIS,
-    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-    See the License for the specific language governing permissions and
-    limitations under the License. 
-******************************************************************************/
-
-#ifndef __ad910x_h__
-#define __ad910x_h__
-#include "mbed.h"
-
-class AD910x_SINGLE {
-    public:
-        #pragma region (Single-Board Code)
-        SPI( spi );             // SPI instance of AD910x
-        DigitalOut( csb );      // DigitalOut instance for AD910x chip select pin
-        DigitalOut( resetb );   // DigitalOut instance for AD910x reset pin
-        DigitalOut( triggerb ); // DigitalOut instance for AD910x trigger pin
- 
-        /*** 4-Wire SPI, Reset, and Trigger configuration & constructor ***/
-        AD910x_SINGLE( PinName CSB = PA_15, PinName MOSI = PA_7, PinName MISO = PB_4, PinName SCK = PB_3,
-                PinName RESETB = PG_11, PinName TRIGGERB = PG_10 );
-     
-        /*** SPI register addresses ***/
-        uint16_t reg_add[66] = {0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x001f, 0x0020, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0047, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x001e, 0x001d};
-    
-        // Function to set up SPI
-        void spi_init( uint8_t reg_len, uint8_t mode, uint32_t hz);
-    
-        // SPI write function
-        void spi_write( uint16_t addr, int16_t data );
-    
-        // SPI read function
-        int16_t spi_read( uint16_t addr );
-
-        // Function to reset SPI register values
-        void AD910x_reg_reset();
-        
-        // Function to display register data
-        void print_data( uint16_t addr, uint16_t data );
-    
-        // Function to write to SRAM
-        void AD910x_update_sram( int16_t data[] );
-    
-        // Function to display n SRAM data
-        void AD910x_print_sram( uint16_t n );
-    
-        // Function to write to device SPI registers and display updated register values
-        void AD910x_update_regs( uint16_t data[] );
-          
-        // Function to start pattern generation
-        void AD910x_start_pattern();
-        
-        // Function to stop pattern generation
-        void AD910x_stop_pattern();
-        #pragma endregion
-};
-
-class AD910x_MULTI {
-    public:
-        #pragma region (Multi-Board Code)
-        SPI( spi );             // SPI instance of AD910x
-        DigitalOut( csb1 );     // DigitalOut instance for AD910x device 1 chip select pin
-        DigitalOut( csb2 );     // DigitalOut instance for AD910x device 2 chip select pin
-        DigitalOut( resetb );   // DigitalOut instance for AD910x reset pin
-        DigitalOut( triggerb ); // DigitalOut instance for AD910x trigger pin
- 
-        /*** 4-Wire SPI, Reset, and Trigger configuration & constructor ***/
-        AD910x_MULTI( PinName CSB1 = PA_15, PinName CSB2 = PB_15, PinName MOSI = PA_7, PinName MISO = PB_4, PinName SCK = PB_3,
-                PinName RESETB = PG_11, PinName TRIGGERB = PG_10 );
-     
-        /*** SPI register addresses ***/
-        uint16_t reg_add[66] = {0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x001f, 0x0020, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0047, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 0x001e, 0x001d};
-    
-        // Function to set up SPI
-        void spi_init( uint8_t reg_len, uint8_t mode, uint32_t hz);
-    
-        // Enable SPI device
-        void spi_en_dev( bool dev_id );
-        
-        // Disable SPI devices
-        void spi_disable_dev();
-        
-        // SPI write function
-        void spi_write( bool dev_id, uint16_t addr, int16_t data );
-    
-        // SPI read function
-        int16_t spi_read( bool dev_id, uint16_t addr );
-
-        // Function to reset SPI register values
-        void AD910x_reg_reset();
-        
-        // Function to display register data
-        void print_data( uint16_t addr, uint16_t data );
-    
-        // Function to write to SRAM
-        void AD910x_update_sram( bool devnum, int16_t data[] );
-    
-        // Function to display n SRAM data
-        void AD910x_print_sram( bool devnum, uint16_t n );
-    
-        // Function to write to device SPI registers and display updated register values
-        void AD910x_update_regs( bool devnum, uint16_t data[] );
-          
-        // Function to start pattern generation
-        void AD910x_start_pattern();
-        
-        // Function to stop pattern generation
-        void AD910x_stop_pattern();
-        #pragma endregion
-};
-#endif
+/******************************************************************************
+    @file:  ad910x.h
+ 
+    @brief: Defines functions for the devices' SPI interface and printing
+            data from SPI read to text-based user interface
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+
+#ifndef __ad910x_h__
+#define __ad910x_h__
+#include <stdint.h>
+#include <stddef.h>
+#include "ad910x_dump.h"
+#include "ad910x_log.h"
+#include "ad910x_regs.h"
+#include "ad910x_transport.h"
+#include "ad910x_wave.h"
+#include "ad910x_wire.h"
+
+#define AD910X_BURST_CHUNK  64      // SRAM words converted per block transfer in burst mode
+#define AD910X_SRAM_FRAMES  ( AD910X_SRAM_SIZE + 1 )    // Frames of a full SRAM upload: instruction word + data
+#define AD910X_TRAIN_ROUNDS 4       // Passes of the test patterns a trained SPI clock must survive
+#define AD910X_TRAIN_MIN_HZ 400000  // Slowest SPI clock tried by AD910x_train_spi
+#define AD910X_REG_GAP      2       // Register gaps shorter than this are resent inside a transaction
+#define AD910X_DIFF_GAP     4       // Unchanged words bridged between two changed ranges instead of starting a new burst
+
+/*** Copy of what the driver last wrote to one device ***/
+struct AD910x_Shadow {
+    uint16_t sram[AD910X_SRAM_SIZE];    // SRAM words in wire format
+    uint32_t sram_known[AD910X_SRAM_SIZE / 32] = {0};   // Bit set: SRAM word matches the device
+    uint16_t regs[AD910X_REG_SPACE];    // SPI register values
+    uint32_t reg_known[AD910X_REG_SPACE / 32] = {0};    // Bit set: register value matches the device
+};
+
+/*** Readback verification policies (AD910x_BASE::verify_mode) ***/
+#define AD910X_VERIFY_NONE      0   // No readback
+#define AD910X_VERIFY_FINAL     1   // One bulk readback of the registers/SRAM words written by the update
+#define AD910X_VERIFY_SAMPLED   2   // Like FINAL, but only every verify_step-th SRAM word
+#define AD910X_VERIFY_FULL      3   // Every known register and SRAM word after each update
+#define AD910X_VERIFY_KEEP      8   // Mismatches recorded in AD910x_VerifyResult
+
+/*** One word that read back different from the shadow ***/
+struct AD910x_Mismatch {
+    uint8_t dev;                        // Device index
+    uint16_t addr;                      // SPI/SRAM address
+    uint16_t expected;                  // Shadow value (SRAM in wire format)
+    uint16_t actual;                    // Value read back
+};
+
+/*** Outcome of the readback of the last update ***/
+struct AD910x_VerifyResult {
+    uint32_t checked;                   // Words read back and compared
+    uint32_t mismatches;                // Words that differed
+    uint8_t recorded;                   // Entries of mismatch[] filled, at most AD910X_VERIFY_KEEP
+    AD910x_Mismatch mismatch[AD910X_VERIFY_KEEP];
+};
+
+/*** SRAM words played by one or more channels ***/
+struct AD910x_SramRange {
+    uint16_t offset;                    // First SRAM word (0 = 0x6000)
+    uint16_t n;                         // Number of words
+};
+
+/*** Digital gain and offset changes of one batch (AD910x_update_channels) ***/
+struct AD910x_ChannelBatch {
+    uint8_t gain_set;                   // Bit ch set: gain[ch] belongs to the batch
+    uint8_t offset_set;                 // Bit ch set: offset[ch] belongs to the batch
+    int16_t gain[AD910X_CHANNELS];      // DACx_DGAIN, -2048..2047, AD910X_DGAIN_UNITY = 1.0
+    int16_t offset[AD910X_CHANNELS];    // DACx_DOF in DAC LSBs, -2048..2047
+};
+
+// Source of SRAM samples for streaming uploads: writes up to max samples to out[] and returns the count
+typedef uint16_t (*AD910x_SampleSource)( void *ctx, int16_t out[], uint16_t max );
+
+/*** Driver traffic counters ***/
+struct AD910x_Stats {
+    uint32_t sram_written;              // SRAM words sent
+    uint32_t sram_skipped;              // SRAM words not sent because the shadow matched
+    uint32_t reg_written;               // Register writes sent by AD910x_update_regs
+    uint32_t reg_skipped;               // Register writes skipped because the shadow matched
+    uint32_t reg_frames_saved;          // Register frames saved by multi-register transactions
+    uint32_t link_errors;               // Failed SPI link tests
+};
+
+class AD910x_BASE {
+    public:
+        #pragma region (Common Code)
+        AD910x_Transport &bus;  // SPI transport of AD910x (see ad910x_spi.h)
+        bool burst_en;          // Stream SRAM words and register runs after one instruction word; false writes one word per transaction
+        bool diff_en;           // Send only SRAM ranges that differ from the shadow
+        bool reg_cache_en;      // Send only registers that differ from the shadow
+        AD910x_Stats stats;     // Traffic counters, cleared by the user
+        uint8_t log_level;      // AD910X_LOG_* level of register/SRAM display (see ad910x_log.h)
+        AD910x_LogQueue *log_queue; // Record queue of AD910X_LOG_DEFERRED, drained by the application
+        uint32_t spi_hz;        // SPI clock set by AD910x_train_spi, 0 if not trained
+        uint32_t spi_edge_hz;   // Fastest SPI clock that passed training; spi_hz runs one prescaler step below it
+        uint32_t spi_max_hz;    // max_hz the application last trained from; AD910x_check_link restarts there
+        uint8_t verify_mode;    // AD910X_VERIFY_* readback after each register/SRAM update
+        uint16_t verify_step;   // SRAM word spacing of AD910X_VERIFY_SAMPLED
+        AD910x_VerifyResult verify_result;  // Readback result of the last update or check
+
+        /*** SPI register addresses ***/
+        static const uint16_t reg_add[66];
+
+        // Function to set up SPI
+        void spi_init( uint8_t reg_len, uint8_t mode, uint32_t hz );
+
+        // Function to reset SPI register values
+        void AD910x_reg_reset();
+
+        // Function to select the fastest SPI clock up to max_hz that passes the link test
+        uint32_t AD910x_train_spi( uint32_t max_hz );
+
+        // Function to test the SPI link at the trained clock and re-train if it fails; a running pattern keeps SRAM and RUN
+        int AD910x_check_link();
+
+        // Function to forget the SRAM shadow, e.g. after power loss of the boards
+        void AD910x_invalidate_sram();
+
+        // Function to forget the register shadow, e.g. after power loss of the boards
+        void AD910x_invalidate_regs();
+        
+        // Function to display register data
+        void print_data( uint16_t addr, uint16_t data );
+
+        // Function to start pattern generation
+        void AD910x_start_pattern();
+        
+        // Function to stop pattern generation
+        void AD910x_stop_pattern();
+
+        // Function to convert n SRAM words into the frame buffer of an asynchronous upload
+        static void AD910x_prepare_sram( uint16_t frames[], const int16_t data[], uint16_t offset, uint16_t n );
+        static void AD910x_prepare_sram( uint16_t frames[], const int32_t data[], uint16_t offset, uint16_t n );
+        static void AD910x_prepare_sram( uint16_t frames[], const float data[], uint16_t offset, uint16_t n );
+
+        // Function to find the SRAM ranges played by a register set, in ascending order
+        static uint8_t AD910x_sram_ranges( const uint16_t regval[], AD910x_SramRange ranges[AD910X_CHANNELS] );
+
+        // Function to check whether an asynchronous SRAM upload is running
+        bool AD910x_sram_busy();
+
+        // Function to wait for an asynchronous SRAM upload and release SRAM to the pattern generator
+        int AD910x_finish_sram();
+
+        // Function to add samples to an SRAM upload opened with AD910x_stream_begin
+        uint16_t AD910x_stream_write( const int16_t samples[], uint16_t k ) { return sram_stream_write( samples, k ); }
+
+        // Function to finish an SRAM upload opened with AD910x_stream_begin
+        uint16_t AD910x_stream_end() { return sram_stream_end(); }
+        #pragma endregion
+
+    protected:
+        friend class AD910x_CmdServer;      // Executes host commands with the device-set primitives (see ad910x_cmdserver.h)
+        friend class AD910x_PresetLib;      // Switches presets of a device set (see ad910x_preset.h)
+        friend class AD910x_Worker;         // Runs queued jobs on the bus thread (see ad910x_worker.h)
+        friend class AD910x_Sweep;          // Writes DDS sweep steps (see ad910x_sweep.h)
+
+        AD910x_BASE( AD910x_Transport &spi_bus, AD910x_Shadow shadows[], uint8_t devs );
+
+        AD910x_Shadow *shadow;  // One shadow per device, owned by the derived class
+        uint8_t num_devs;       // Number of devices on the bus
+
+        // SPI write to the devices in dev_mask
+        void dev_write( uint32_t dev_mask, uint16_t addr, int16_t data );
+
+        // SPI read from the lowest device in dev_mask
+        int16_t dev_read( uint32_t dev_mask, uint16_t addr );
+
+        // Write and read back test patterns to a scratch register and SRAM region of every device
+        bool link_test( int rounds );
+
+        // Streaming SPI read of n consecutive addresses from the lowest device in dev_mask
+        void dev_read_block( uint32_t dev_mask, uint16_t addr, uint16_t data[], uint16_t n );
+
+        // Read n SRAM words in wire format from the lowest device in dev_mask, leaving PAT_STATUS as it was
+        void dev_read_sram( uint32_t dev_mask, uint16_t offset, uint16_t data[], uint16_t n );
+
+        // Read back registers in regs[] and SRAM words lo..hi-1 (every step-th) and compare them to the shadow
+        const AD910x_VerifyResult &dev_verify( uint32_t dev_mask, const uint32_t regs[], uint16_t lo, uint16_t hi, uint16_t step );
+
+        // Check the devices in dev_mask against the shadow according to mode
+        const AD910x_VerifyResult &dev_check( uint32_t dev_mask, uint8_t mode );
+
+        // Apply verify_mode after an update that wrote registers in regs[] and SRAM words lo..hi-1
+        void verify_update( uint32_t dev_mask, const uint32_t regs[], uint16_t lo, uint16_t hi );
+
+        // Compare one word read back with its shadow value and record a mismatch
+        void verify_word( uint8_t dev, uint16_t addr, uint16_t expected, uint16_t actual );
+
+        // Read back registers (and SRAM) of the devices in dev_mask and count differences between them
+        int dev_verify_match( uint32_t dev_mask, bool sram );
+
+        // Write to SRAM of the devices in dev_mask
+        int dev_update_sram( uint32_t dev_mask, const int16_t data[] );
+
+        // Write n words to SRAM of the devices in dev_mask, starting at offset
+        int dev_update_sram_range( uint32_t dev_mask, uint16_t offset, uint16_t n, const int16_t data[] );
+
+        // Write the SRAM words a register set plays, taken from a full SRAM image
+        int dev_update_sram_used( uint32_t dev_mask, const int16_t image[], const uint16_t regval[] );
+
+        // Start an asynchronous SRAM upload of prepared frames to the devices in dev_mask
+        int dev_update_sram_async( uint32_t dev_mask, const uint16_t frames[], uint16_t n, AD910x_Callback cb, void *ctx );
+
+        // Decode a packed waveform into SRAM of the devices in dev_mask
+        int dev_update_sram_packed( uint32_t dev_mask, const AD910x_PackedWave &wave );
+
+        // Write n words from a sample source to SRAM of the devices in dev_mask, starting at offset
+        int dev_stream_sram( uint32_t dev_mask, uint16_t offset, uint16_t n, AD910x_SampleSource source, void *ctx );
+
+        // Open an SRAM upload of n words at offset, fed piecewise by sram_stream_write
+        int sram_stream_begin( uint32_t dev_mask, uint16_t offset, uint16_t n );
+
+        // Convert k samples and write them to the open upload; the burst ends before it returns
+        uint16_t sram_stream_write( const int16_t samples[], uint16_t k );
+
+        // Convert k samples and add them to the running burst of the open upload
+        uint16_t stream_put( const int16_t samples[], uint16_t k );
+
+        // Flush and close the open upload
+        uint16_t sram_stream_end();
+
+        // Queue one SRAM word of the running burst (PAT_STATUS must grant memory access)
+        void sram_put( uint32_t dev_mask, uint16_t pos, uint16_t word );
+
+        // Send queued SRAM words and end the running burst
+        void sram_close( uint32_t dev_mask );
+
+        // Check whether an SRAM word differs from the shadow of any device in dev_mask
+        bool sram_dirty( uint32_t dev_mask, uint16_t pos, uint16_t word );
+
+        // Check whether a register value differs from the shadow of any device in dev_mask
+        bool reg_dirty( uint32_t dev_mask, uint16_t addr, uint16_t data );
+
+        // Record a register value written to the devices in dev_mask
+        void shadow_reg( uint32_t dev_mask, uint16_t addr, uint16_t data );
+
+        // Stream registers and n SRAM words of the devices in dev_mask as framed binary
+        int32_t dev_dump( uint32_t dev_mask, uint16_t n, AD910x_DumpWrite write, void *ctx );
+
+        // Display or queue one register/SRAM word according to log_level
+        void log_data( uint16_t addr, uint16_t data );
+
+        // Index of the lowest device in dev_mask
+        int first_dev( uint32_t dev_mask );
+
+        // Record wire-format SRAM words written to the devices in dev_mask
+        void shadow_sram( uint32_t dev_mask, uint16_t offset, const uint16_t frames[], uint16_t n );
+
+        // Display n SRAM data of the device in dev_mask
+        void dev_print_sram( uint32_t dev_mask, uint16_t n );
+
+        // Write to SPI registers of the device in dev_mask and display updated values
+        void dev_update_regs( uint32_t dev_mask, const uint16_t data[] );
+
+        // Write a register set to the devices in dev_mask in as few transactions as possible
+        uint32_t dev_write_regs( uint32_t dev_mask, const uint16_t addr[], const uint16_t data[], uint16_t n );
+
+        // Write the changed digital gains and offsets of a batch to the devices in dev_mask and latch them with one RAMUPDATE
+        int dev_update_channels( uint32_t dev_mask, const AD910x_ChannelBatch &batch );
+
+    private:
+        /*** Running SRAM burst ***/
+        bool sram_open;             // Chip select asserted, instruction word sent
+        uint16_t sram_next;         // SRAM word the device writes next
+        uint16_t sram_first;        // SRAM word of sram_frames[0]
+        uint16_t sram_nframes;      // Queued frames
+        uint16_t sram_frames[AD910X_BURST_CHUNK];
+
+        /*** Open piecewise SRAM upload (sram_stream_begin) ***/
+        uint32_t stream_mask;       // Devices of the upload, 0 if none
+        uint16_t stream_pos;        // SRAM word of the next sample
+        uint16_t stream_stop;       // SRAM word after the last one
+        bool stream_mem;            // PAT_STATUS grants memory access
+        uint16_t stream_written;    // Words sent
+        uint16_t stream_skipped;    // Words not sent because the shadow matched
+        uint16_t stream_lo;         // Range of sent words, for verify_update
+        uint16_t stream_hi;
+
+        /*** Asynchronous SRAM upload state ***/
+        volatile bool async_busy;   // Block transfer running, chip select asserted
+        volatile int async_event;   // AD910X_EVENT_* of the last block transfer
+        uint32_t async_mask;        // Devices of the pending upload, 0 if none
+        const uint16_t *async_frames;   // Frames of the pending upload
+        uint16_t async_n;
+        AD910x_Callback async_cb;   // User completion callback
+        void *async_ctx;
+
+        static void sram_async_done( void *ctx, int event );
+};
+
+class AD910x_SINGLE : public AD910x_BASE {
+    public:
+        #pragma region (Single-Board Code)
+        AD910x_SINGLE( AD910x_Transport &spi_bus );
+
+        AD910x_Shadow dev_shadow[1];    // SRAM shadow of the device
+    
+        // SPI write function
+        void spi_write( uint16_t addr, int16_t data );
+    
+        // SPI read function
+        int16_t spi_read( uint16_t addr );
+    
+        // Function to write to SRAM
+        int AD910x_update_sram( const int16_t data[] );
+
+        // Function to write n words to SRAM, starting at offset
+        int AD910x_update_sram_range( uint16_t offset, uint16_t n, const int16_t data[] );
+
+        // Function to write only the SRAM words played by a register set
+        int AD910x_update_sram_used( const int16_t image[], const uint16_t regval[] );
+
+        // Function to open an SRAM upload of n words at offset, fed piecewise with AD910x_stream_write
+        int AD910x_stream_begin( uint16_t offset, uint16_t n );
+
+        // Function to decode a packed waveform into SRAM
+        int AD910x_update_sram_packed( const AD910x_PackedWave &wave );
+
+        // Function to write prepared frames to SRAM in the background
+        int AD910x_update_sram_async( const uint16_t frames[], uint16_t n, AD910x_Callback cb = NULL, void *ctx = NULL );
+    
+        // Function to display n SRAM data
+        void AD910x_print_sram( uint16_t n );
+
+        // Function to stream registers and n SRAM words as framed binary (see ad910x_dump.h)
+        int32_t AD910x_dump( uint16_t n, AD910x_DumpWrite write, void *ctx );
+    
+        // Function to write to device SPI registers and display updated register values
+        void AD910x_update_regs( const uint16_t data[] );
+
+        // Function to write n registers (any addresses, any order) in as few transactions as possible
+        uint32_t AD910x_write_regs( const uint16_t addr[], const uint16_t data[], uint16_t n );
+
+        // Function to change the digital gain/offset of several channels with one RAMUPDATE
+        int AD910x_update_channels( const AD910x_ChannelBatch &batch );
+
+        // Function to read back the device and compare it to the shadow
+        const AD910x_VerifyResult &AD910x_verify( uint8_t mode );
+        #pragma endregion
+};
+
+class AD910x_MULTI : public AD910x_BASE {
+    public:
+        #pragma region (Multi-Board Code)
+        AD910x_MULTI( AD910x_Transport &spi_bus );
+
+        AD910x_Shadow dev_shadow[2];    // SRAM shadows of device 1 and device 2
+    
+        // Enable SPI device
+        void spi_en_dev( bool dev_id );
+        
+        // Disable SPI devices
+        void spi_disable_dev();
+        
+        // SPI write function
+        void spi_write( bool dev_id, uint16_t addr, int16_t data );
+    
+        // SPI read function
+        int16_t spi_read( bool dev_id, uint16_t addr );
+    
+        // Function to write to SRAM
+        int AD910x_update_sram( bool devnum, const int16_t data[] );
+
+        // Function to write n words to SRAM, starting at offset
+        int AD910x_update_sram_range( bool devnum, uint16_t offset, uint16_t n, const int16_t data[] );
+
+        // Function to write only the SRAM words played by a register set
+        int AD910x_update_sram_used( bool devnum, const int16_t image[], const uint16_t regval[] );
+
+        // Function to open an SRAM upload of n words at offset, fed piecewise with AD910x_stream_write
+        int AD910x_stream_begin( bool devnum, uint16_t offset, uint16_t n );
+
+        // Function to decode a packed waveform into SRAM
+        int AD910x_update_sram_packed( bool devnum, const AD910x_PackedWave &wave );
+
+        // Function to write prepared frames to SRAM in the background
+        int AD910x_update_sram_async( bool devnum, const uint16_t frames[], uint16_t n, AD910x_Callback cb = NULL, void *ctx = NULL );
+    
+        // Function to display n SRAM data
+        void AD910x_print_sram( bool devnum, uint16_t n );
+
+        // Function to stream registers and n SRAM words as framed binary (see ad910x_dump.h)
+        int32_t AD910x_dump( bool devnum, uint16_t n, AD910x_DumpWrite write, void *ctx );
+    
+        // Function to write to device SPI registers and display updated register values
+        void AD910x_update_regs( bool devnum, const uint16_t data[] );
+
+        // Function to write n registers (any addresses, any order) in as few transactions as possible
+        uint32_t AD910x_write_regs( bool devnum, const uint16_t addr[], const uint16_t data[], uint16_t n );
+
+        // Function to change the digital gain/offset of several channels with one RAMUPDATE
+        int AD910x_update_channels( bool devnum, const AD910x_ChannelBatch &batch );
+
+        // Function to read back a device and compare it to the shadow
+        const AD910x_VerifyResult &AD910x_verify( bool devnum, uint8_t mode );
+
+        /*** Broadcast writes: both chip selects asserted, reads stay per device ***/
+        // SPI write to both devices
+        void spi_write_all( uint16_t addr, int16_t data );
+
+        // Function to write the same data to SRAM of both devices
+        int AD910x_update_sram_all( const int16_t data[] );
+
+        // Function to decode a packed waveform into SRAM of both devices
+        int AD910x_update_sram_packed_all( const AD910x_PackedWave &wave );
+
+        // Function to write the same register set to both devices
+        void AD910x_update_regs_all( const uint16_t data[] );
+
+        // Function to check that both devices hold the same registers (and SRAM)
+        int AD910x_verify_match( bool sram );
+        #pragma endregion
+};
+
+// Device-set mask of device n (0-based) for AD910x_ARRAY
+#define AD910X_DEV( n )         ( 1u << ( n ) )
+
+template <uint8_t N>
+class AD910x_ARRAY : public AD910x_BASE {
+    static_assert( N >= 1 && N <= AD910X_MAX_DEVS, "AD910x_ARRAY supports 1 to AD910X_MAX_DEVS devices" );
+
+    public:
+        #pragma region (N-Board Code)
+        AD910x_ARRAY( AD910x_Transport &spi_bus ) : AD910x_BASE( spi_bus, dev_shadow, N ) {
+        }
+
+        AD910x_Shadow dev_shadow[N];    // Shadow of each device
+
+        // Mask selecting every device
+        static constexpr uint32_t all() { return ( N == 32 ) ? 0xFFFFFFFFu : ( 1u << N ) - 1; }
+
+        // SPI write to the devices in dev_mask at once
+        void spi_write( uint32_t dev_mask, uint16_t addr, int16_t data ) { dev_write( dev_mask, addr, data ); }
+
+        // SPI read from device dev
+        int16_t spi_read( uint8_t dev, uint16_t addr ) { return dev_read( AD910X_DEV( dev ), addr ); }
+
+        // Function to write the same data to SRAM of the devices in dev_mask
+        int AD910x_update_sram( uint32_t dev_mask, const int16_t data[] ) { return dev_update_sram( dev_mask, data ); }
+
+        // Function to write n words to SRAM of the devices in dev_mask, starting at offset
+        int AD910x_update_sram_range( uint32_t dev_mask, uint16_t offset, uint16_t n, const int16_t data[] ) {
+            return dev_update_sram_range( dev_mask, offset, n, data );
+        }
+
+        // Function to write only the SRAM words played by a register set to the devices in dev_mask
+        int AD910x_update_sram_used( uint32_t dev_mask, const int16_t image[], const uint16_t regval[] ) {
+            return dev_update_sram_used( dev_mask, image, regval );
+        }
+
+        // Function to open an SRAM upload of n words at offset to the devices in dev_mask, fed with AD910x_stream_write
+        int AD910x_stream_begin( uint32_t dev_mask, uint16_t offset, uint16_t n ) { return sram_stream_begin( dev_mask, offset, n ); }
+
+        // Function to decode a packed waveform into SRAM of the devices in dev_mask
+        int AD910x_update_sram_packed( uint32_t dev_mask, const AD910x_PackedWave &wave ) { return dev_update_sram_packed( dev_mask, wave ); }
+
+        // Function to write prepared frames to SRAM of the devices in dev_mask in the background
+        int AD910x_update_sram_async( uint32_t dev_mask, const uint16_t frames[], uint16_t n, AD910x_Callback cb = NULL, void *ctx = NULL ) {
+            return dev_update_sram_async( dev_mask, frames, n, cb, ctx );
+        }
+
+        // Function to display n SRAM data of device dev
+        void AD910x_print_sram( uint8_t dev, uint16_t n ) { dev_print_sram( AD910X_DEV( dev ), n ); }
+
+        // Function to stream registers and n SRAM words of the devices in dev_mask as framed binary
+        int32_t AD910x_dump( uint32_t dev_mask, uint16_t n, AD910x_DumpWrite write, void *ctx ) {
+            return dev_dump( dev_mask, n, write, ctx );
+        }
+
+        // Function to write the same register set to the devices in dev_mask
+        void AD910x_update_regs( uint32_t dev_mask, const uint16_t data[] ) { dev_update_regs( dev_mask, data ); }
+
+        // Function to write n registers (any addresses, any order) to the devices in dev_mask in as few transactions as possible
+        uint32_t AD910x_write_regs( uint32_t dev_mask, const uint16_t addr[], const uint16_t data[], uint16_t n ) {
+            return dev_write_regs( dev_mask, addr, data, n );
+        }
+
+        // Function to change the digital gain/offset of several channels of the devices in dev_mask with one RAMUPDATE
+        int AD910x_update_channels( uint32_t dev_mask, const AD910x_ChannelBatch &batch ) { return dev_update_channels( dev_mask, batch ); }
+
+        // Function to read back the devices in dev_mask and compare them to the shadow
+        const AD910x_VerifyResult &AD910x_verify( uint32_t dev_mask, uint8_t mode ) { return dev_check( dev_mask, mode ); }
+
+        // Function to check that the devices in dev_mask hold the same registers (and SRAM)
+        int AD910x_verify_match( uint32_t dev_mask, bool sram ) { return dev_verify_match( dev_mask, sram ); }
+        #pragma endregion
+};
+#endif
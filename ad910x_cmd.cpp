@@ -0,0 +1,84 @@
+/******************************************************************************
+    @file:  ad910x_cmd.cpp
+
+    @brief: Implements the framing of the command protocol between a host and
+            the SDP-K1, shared by the board and host sides
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <string.h>
+#include "ad910x_cmd.h"
+#include "ad910x_dump.h"
+
+#pragma region (FRAMING)
+//  * @brief Encode one command or response frame
+//  * @param out[] - output, at least AD910X_CMD_FRAME_MAX bytes
+//  * @param seq - sequence number
+//  * @param cmd - AD910X_CMD_*, with AD910X_CMD_REPLY for responses
+//  * @param payload[] - len bytes, may be NULL if len is 0
+//  * @param len - payload size, at most AD910X_CMD_PAYLOAD
+//  * @return frame size in bytes
+
+uint32_t AD910x_cmd_frame( uint8_t out[], uint8_t seq, uint8_t cmd, const uint8_t payload[], uint16_t len ) {
+    out[0] = AD910X_CMD_SYNC0;
+    out[1] = AD910X_CMD_SYNC1;
+    out[2] = seq;
+    out[3] = cmd;
+    AD910x_cmd_put16( out + 4, len );
+    if ( len != 0 ) {
+        memcpy( out + 6, payload, len );
+    }
+    AD910x_cmd_put16( out + 6 + len, AD910x_dump_crc( 0xFFFF, out + 2, 4 + len ) );
+    return AD910X_CMD_OVERHEAD + len;
+}
+
+AD910x_CmdParser::AD910x_CmdParser() : seq( 0 ), cmd( 0 ), len( 0 ), crc_errors( 0 ), pos( 0 ), need( 0 ) {
+}
+
+//  * @brief Consume one byte of a command stream. Bytes outside frames are
+//  *        ignored; after a bad frame the parser searches for the next sync.
+//  * @param byte - next byte
+//  * @return true if the byte completed a valid frame (see seq, cmd, len, payload)
+
+bool AD910x_CmdParser::feed( uint8_t byte ) {
+    if ( ( pos == 0 && byte != AD910X_CMD_SYNC0 ) || ( pos == 1 && byte != AD910X_CMD_SYNC1 ) ) {
+        pos = ( byte == AD910X_CMD_SYNC0 ) ? 1 : 0;
+        return false;
+    }
+    buf[pos++] = byte;
+    
+    if ( pos == 6 ) {
+        uint16_t size = AD910x_cmd_get16( buf + 4 );
+        if ( size > AD910X_CMD_PAYLOAD ) {
+            crc_errors++;
+            pos = 0;
+            return false;
+        }
+        need = AD910X_CMD_OVERHEAD + size;
+    }
+    if ( pos < 6 || pos < need ) {
+        return false;
+    }
+    
+    pos = 0;
+    if ( AD910x_dump_crc( 0xFFFF, buf + 2, need - 4 ) != AD910x_cmd_get16( buf + need - 2 ) ) {
+        crc_errors++;
+        return false;
+    }
+    seq = buf[2];
+    cmd = buf[3];
+    len = need - AD910X_CMD_OVERHEAD;
+    memcpy( payload, buf + 6, len );
+    return true;
+}
+#pragma endregion
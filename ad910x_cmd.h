@@ -0,0 +1,119 @@
+/******************************************************************************
+    @file:  ad910x_cmd.h
+
+    @brief: Defines the framed binary command protocol between a host and the
+            SDP-K1 (see ad910x_cmdserver.h for the board side)
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_cmd_h__
+#define __ad910x_cmd_h__
+#include <stdint.h>
+
+/*** Command and response frame, multi-byte fields little-endian:
+       0xA5 0xC3            sync
+       seq                  sequence number chosen by the host, echoed in the response
+       cmd                  AD910X_CMD_*; the response has AD910X_CMD_REPLY set
+       len (2)              payload bytes, at most AD910X_CMD_PAYLOAD
+       payload (len)
+       crc (2)              CRC-16/CCITT-FALSE of seq .. payload (see AD910x_dump_crc)
+     Frames with a bad CRC are dropped; the host retries with the same seq.
+     A receiver idle for AD910X_CMD_IDLE_MS drops a partial frame, so a
+     corrupt length field cannot swallow the retry.
+     A retried command is not executed again, its response is resent. ***/
+#define AD910X_CMD_SYNC0        0xA5
+#define AD910X_CMD_SYNC1        0xC3
+#define AD910X_CMD_IDLE_MS      20              // Receive gap ending a partial frame, below the host retry timeout
+#define AD910X_CMD_OVERHEAD     8               // Sync, header and CRC bytes of a frame
+#define AD910X_CMD_WORDS        256             // Words per register/SRAM command
+#define AD910X_CMD_PAYLOAD      ( 8 + 4 * AD910X_CMD_WORDS )
+#define AD910X_CMD_FRAME_MAX    ( AD910X_CMD_OVERHEAD + AD910X_CMD_PAYLOAD )
+
+/*** Commands. mask is a uint32 device set; reads use its lowest device.
+     Response payloads start with an AD910X_STATUS_* byte. ***/
+#define AD910X_CMD_PING         0x01            // -> status
+#define AD910X_CMD_WRITE_REGS   0x02            // mask, n (2), n x { addr, data } -> status
+#define AD910X_CMD_READ_REGS    0x03            // mask, addr, n -> status, n words
+#define AD910X_CMD_WRITE_SRAM   0x04            // mask, offset, n, n samples -> status
+#define AD910X_CMD_READ_SRAM    0x05            // mask, offset, n -> status, n words in wire format
+#define AD910X_CMD_START        0x06            // -> status
+#define AD910X_CMD_STOP         0x07            // -> status
+#define AD910X_CMD_STATUS       0x08            // mask -> status, PAT_STATUS, CFG_ERROR, spi_hz (4), link_errors (4), mismatches (4)
+#define AD910X_CMD_STREAM_BEGIN 0x09            // mask, offset, n -> status, window (1), chunk (2)
+#define AD910X_CMD_STREAM_DATA  0x0A            // index (2), up to chunk samples -> status, next index (2)
+#define AD910X_CMD_STREAM_END   0x0B            // -> status, words received (2)
+#define AD910X_CMD_REPLY        0x80
+
+#define AD910X_STATUS_OK        0x00
+#define AD910X_STATUS_UNKNOWN   0x01            // Unknown command
+#define AD910X_STATUS_LENGTH    0x02            // Payload length does not match the command
+#define AD910X_STATUS_RANGE     0x03            // Address, count or device mask out of range
+#define AD910X_STATUS_ORDER     0x04            // Stream chunk out of order; the reply holds the expected index
+#define AD910X_STATUS_STATE     0x05            // No stream open, or one is open already
+#define AD910X_STATUS_BUSY      0x06            // Not run: the board's bus queue is full; resend with the same sequence number
+
+/*** Streamed SRAM upload: after STREAM_BEGIN the host keeps up to window
+     STREAM_DATA frames unacknowledged. The board converts and writes each
+     chunk while the next one is received, so it holds two chunks, not the
+     waveform. Any other command ends an open stream. ***/
+#define AD910X_STREAM_CHUNK     64              // Samples per STREAM_DATA frame
+#define AD910X_STREAM_WINDOW    2               // Frames the host may send ahead of acknowledgements
+
+// Encode one frame into out[] (AD910X_CMD_FRAME_MAX bytes); returns its size
+uint32_t AD910x_cmd_frame( uint8_t out[], uint8_t seq, uint8_t cmd, const uint8_t payload[], uint16_t len );
+
+/*** Little-endian fields of frames and payloads, shared by both ends ***/
+static inline uint16_t AD910x_cmd_get16( const uint8_t p[] ) {
+    return p[0] | p[1] << 8;
+}
+
+static inline uint32_t AD910x_cmd_get32( const uint8_t p[] ) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline void AD910x_cmd_put16( uint8_t p[], uint16_t v ) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static inline void AD910x_cmd_put32( uint8_t p[], uint32_t v ) {
+    AD910x_cmd_put16( p, v & 0xFFFF );
+    AD910x_cmd_put16( p + 2, v >> 16 );
+}
+
+/*** Frame parser of a command byte stream, used on both ends ***/
+class AD910x_CmdParser {
+    public:
+        AD910x_CmdParser();
+
+        // Consume one byte; true when it completed a frame with a valid CRC
+        bool feed( uint8_t byte );
+
+        // Drop a partly received frame
+        void reset() { pos = 0; }
+
+        /*** Last complete frame ***/
+        uint8_t seq;
+        uint8_t cmd;
+        uint16_t len;
+        uint8_t payload[AD910X_CMD_PAYLOAD];
+
+        uint32_t crc_errors;        // Frames dropped because of a CRC mismatch or bad header
+
+    private:
+        uint8_t buf[AD910X_CMD_FRAME_MAX];
+        uint32_t pos;               // Bytes of the current frame received
+        uint32_t need;              // Size of the current frame, 0 while the header is incomplete
+};
+#endif
@@ -0,0 +1,243 @@
+/******************************************************************************
+    @file:  ad910x_cmdserver.cpp
+
+    @brief: Implements the board side of the host command protocol: parses
+            command frames, executes them with the driver and answers them
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <string.h>
+#include "ad910x_cmdserver.h"
+
+#pragma region (SERVER)
+//  * @param driver - driver of the devices the commands address
+//  * @param write - byte sink of responses
+//  * @param ctx - argument passed to write
+//  * @param worker - started worker of driver, NULL if the server is its only user
+
+AD910x_CmdServer::AD910x_CmdServer( AD910x_BASE &driver, AD910x_CmdWrite write, void *ctx, AD910x_Worker *worker ) :
+        commands( 0 ), retries( 0 ), busy( 0 ), dev( driver ), bus( worker ), out( write ), out_ctx( ctx ), last_len( 0 ),
+        last_seq( -1 ), last_cmd( 0 ), streaming( false ), stream_next( 0 ) {
+    job.type = AD910X_JOB_CALL;
+    job.call = run_command;
+    job.ctx = this;
+}
+
+//  * @brief Consume one received byte. A complete command is executed and
+//  *        answered before the call returns; a command repeating the
+//  *        sequence number of the previous one is only answered again.
+//  *        With a worker the command runs as one job, so its driver calls
+//  *        do not interleave with those of other producers.
+//  * @param byte - received byte
+//  * @return none
+
+void AD910x_CmdServer::feed( uint8_t byte ) {
+    if ( !rx.feed( byte ) ) {
+        return;
+    }
+    if ( rx.seq == last_seq && rx.cmd == last_cmd ) {
+        retries++;
+        out( out_ctx, last, last_len );
+        return;
+    }
+    
+    uint16_t len;
+    if ( bus == NULL ) {
+        len = execute();
+    } else if ( bus->submit( job ) == 0 ) {
+        len = (uint16_t)bus->wait( job );
+    } else {
+        // * Not run: answer without recording the sequence number, so the resent command executes * //
+        busy++;
+        reply[0] = AD910X_STATUS_BUSY;
+        last_seq = -1;
+        last_len = AD910x_cmd_frame( last, rx.seq, rx.cmd | AD910X_CMD_REPLY, reply, 1 );
+        out( out_ctx, last, last_len );
+        return;
+    }
+    commands++;
+    last_seq = rx.seq;
+    last_cmd = rx.cmd;
+    last_len = AD910x_cmd_frame( last, rx.seq, rx.cmd | AD910X_CMD_REPLY, reply, len );
+    out( out_ctx, last, last_len );
+}
+
+//  * @brief Worker job of a command: execute it on the bus thread
+//  * @param ctx - server
+//  * @return response payload size
+
+int32_t AD910x_CmdServer::run_command( void *ctx ) {
+    return ( (AD910x_CmdServer *)ctx )->execute();
+}
+
+//  * @brief Execute the command in rx and build its response in reply[]
+//  * @param none
+//  * @return response payload size
+
+uint16_t AD910x_CmdServer::execute() {
+    const uint8_t *p = rx.payload;
+    int16_t *samples = (int16_t *)words;
+    uint32_t mask = ( rx.len >= 4 ) ? AD910x_cmd_get32( p ) : 0;
+    uint32_t all = ( dev.num_devs >= 32 ) ? 0xFFFFFFFF : ( 1u << dev.num_devs ) - 1;
+    uint16_t n;
+    
+    reply[0] = AD910X_STATUS_OK;
+    if ( streaming && rx.cmd != AD910X_CMD_STREAM_DATA && rx.cmd != AD910X_CMD_STREAM_END ) {
+        dev.sram_stream_end();
+        streaming = false;
+    }
+    
+    switch ( rx.cmd ) {
+        case AD910X_CMD_PING:
+            return 1;
+        
+        case AD910X_CMD_START:
+            dev.AD910x_start_pattern();
+            return 1;
+        
+        case AD910X_CMD_STOP:
+            dev.AD910x_stop_pattern();
+            return 1;
+        
+        case AD910X_CMD_WRITE_REGS: {
+            n = ( rx.len >= 6 ) ? AD910x_cmd_get16( p + 4 ) : 0;
+            if ( rx.len < 6 || n > AD910X_CMD_WORDS || rx.len != 6 + 4 * n ) {
+                reply[0] = AD910X_STATUS_LENGTH;
+                return 1;
+            }
+            for ( int i=0; i<n; i++ ) {
+                addrs[i] = AD910x_cmd_get16( p + 6 + 4 * i );
+                words[i] = AD910x_cmd_get16( p + 8 + 4 * i );
+                if ( addrs[i] >= AD910X_REG_SPACE ) {
+                    reply[0] = AD910X_STATUS_RANGE;
+                }
+            }
+            if ( mask == 0 || ( mask & ~all ) != 0 ) {
+                reply[0] = AD910X_STATUS_RANGE;
+            }
+            if ( reply[0] == AD910X_STATUS_OK ) {
+                dev.dev_write_regs( mask, addrs, words, n );
+            }
+            return 1;
+        }
+        
+        case AD910X_CMD_WRITE_SRAM: {
+            n = ( rx.len >= 8 ) ? AD910x_cmd_get16( p + 6 ) : 0;
+            if ( rx.len < 8 || n > AD910X_CMD_WORDS || rx.len != 8 + 2 * n ) {
+                reply[0] = AD910X_STATUS_LENGTH;
+                return 1;
+            }
+            for ( int i=0; i<n; i++ ) {
+                samples[i] = (int16_t)AD910x_cmd_get16( p + 8 + 2 * i );
+            }
+            if ( mask == 0 || ( mask & ~all ) != 0 || dev.dev_update_sram_range( mask, AD910x_cmd_get16( p + 4 ), n, samples ) != 0 ) {
+                reply[0] = AD910X_STATUS_RANGE;
+            }
+            return 1;
+        }
+        
+        case AD910X_CMD_READ_REGS:
+        case AD910X_CMD_READ_SRAM: {
+            if ( rx.len != 8 ) {
+                reply[0] = AD910X_STATUS_LENGTH;
+                return 1;
+            }
+            uint16_t addr = AD910x_cmd_get16( p + 4 );
+            bool sram = ( rx.cmd == AD910X_CMD_READ_SRAM );
+            uint32_t end = (uint32_t)addr + AD910x_cmd_get16( p + 6 );
+            n = AD910x_cmd_get16( p + 6 );
+            if ( ( mask & all ) == 0 || n > AD910X_CMD_WORDS || end > ( sram ? AD910X_SRAM_SIZE : AD910X_REG_SPACE ) ) {
+                reply[0] = AD910X_STATUS_RANGE;
+                return 1;
+            }
+            uint32_t one = 1u << dev.first_dev( mask & all );
+            if ( sram ) {
+                dev.dev_read_sram( one, addr, words, n );
+            } else {
+                dev.dev_read_block( one, addr, words, n );
+            }
+            for ( int i=0; i<n; i++ ) {
+                AD910x_cmd_put16( reply + 1 + 2 * i, words[i] );
+            }
+            return 1 + 2 * n;
+        }
+        
+        case AD910X_CMD_STATUS: {
+            if ( rx.len != 4 || ( mask & all ) == 0 ) {
+                reply[0] = ( rx.len != 4 ) ? AD910X_STATUS_LENGTH : AD910X_STATUS_RANGE;
+                return 1;
+            }
+            uint32_t one = 1u << dev.first_dev( mask & all );
+            AD910x_cmd_put16( reply + 1, dev.dev_read( one, AD910X_REG_PAT_STATUS ) );
+            AD910x_cmd_put16( reply + 3, dev.dev_read( one, AD910X_REG_CFG_ERROR ) );
+            AD910x_cmd_put32( reply + 5, dev.spi_hz );
+            AD910x_cmd_put32( reply + 9, dev.stats.link_errors );
+            AD910x_cmd_put32( reply + 13, dev.verify_result.mismatches );
+            return 17;
+        }
+        
+        case AD910X_CMD_STREAM_BEGIN:
+            if ( rx.len != 8 ) {
+                reply[0] = AD910X_STATUS_LENGTH;
+                return 1;
+            }
+            if ( mask == 0 || ( mask & ~all ) != 0 || dev.sram_stream_begin( mask, AD910x_cmd_get16( p + 4 ), AD910x_cmd_get16( p + 6 ) ) != 0 ) {
+                reply[0] = AD910X_STATUS_RANGE;
+                return 1;
+            }
+            streaming = true;
+            stream_next = 0;
+            reply[1] = AD910X_STREAM_WINDOW;
+            AD910x_cmd_put16( reply + 2, AD910X_STREAM_CHUNK );
+            return 4;
+        
+        case AD910X_CMD_STREAM_DATA: {
+            n = ( rx.len - 2 ) / 2;
+            if ( rx.len < 2 || rx.len % 2 != 0 || n > AD910X_STREAM_CHUNK ) {
+                reply[0] = AD910X_STATUS_LENGTH;
+                return 1;
+            }
+            if ( !streaming ) {
+                reply[0] = AD910X_STATUS_STATE;
+                return 1;
+            }
+            // * A repeated chunk was written already; a later one means a chunk was lost * //
+            uint16_t index = AD910x_cmd_get16( p );
+            if ( index == stream_next ) {
+                for ( int i=0; i<n; i++ ) {
+                    samples[i] = (int16_t)AD910x_cmd_get16( p + 2 + 2 * i );
+                }
+                dev.sram_stream_write( samples, n );
+                stream_next++;
+            } else if ( (int16_t)( index - stream_next ) > 0 ) {
+                reply[0] = AD910X_STATUS_ORDER;
+            }
+            AD910x_cmd_put16( reply + 1, stream_next );
+            return 3;
+        }
+        
+        case AD910X_CMD_STREAM_END:
+            if ( !streaming ) {
+                reply[0] = AD910X_STATUS_STATE;
+                return 1;
+            }
+            streaming = false;
+            AD910x_cmd_put16( reply + 1, dev.sram_stream_end() );
+            return 3;
+        
+        default:
+            reply[0] = AD910X_STATUS_UNKNOWN;
+            return 1;
+    }
+}
+#pragma endregion
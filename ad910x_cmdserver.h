@@ -0,0 +1,68 @@
+/******************************************************************************
+    @file:  ad910x_cmdserver.h
+
+    @brief: Defines the board side of the host command protocol (see ad910x_cmd.h)
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_cmdserver_h__
+#define __ad910x_cmdserver_h__
+#include <stdint.h>
+#include "ad910x.h"
+#include "ad910x_cmd.h"
+#include "ad910x_worker.h"
+
+// Byte sink of response frames, e.g. the UART; returns 0 on success
+typedef int (*AD910x_CmdWrite)( void *ctx, const uint8_t data[], uint32_t n );
+
+/*** Executes host commands on the devices of one driver ***/
+class AD910x_CmdServer {
+    public:
+        // With a worker, commands run on its bus thread and the driver may be shared with other producers
+        AD910x_CmdServer( AD910x_BASE &driver, AD910x_CmdWrite write, void *ctx, AD910x_Worker *worker = NULL );
+
+        // Consume one received byte; executes and answers a command when its frame is complete
+        void feed( uint8_t byte );
+
+        // Call when nothing was received for AD910X_CMD_IDLE_MS
+        void idle() { rx.reset(); }
+
+        uint32_t commands;          // Commands executed
+        uint32_t retries;           // Repeated frames answered from the last response
+        uint32_t busy;              // Commands refused because the worker queue was full
+
+    private:
+        // Execute the parsed command and build its response payload in reply[]; returns the payload size
+        uint16_t execute();
+
+        // Body of the worker job of a command
+        static int32_t run_command( void *ctx );
+
+        AD910x_BASE &dev;
+        AD910x_Worker *bus;                     // Worker of the driver, NULL to call it directly
+        AD910x_Job job;                         // Worker job of the command being executed
+        AD910x_CmdWrite out;
+        void *out_ctx;
+        AD910x_CmdParser rx;
+        uint8_t reply[AD910X_CMD_PAYLOAD];      // Response payload of the command being executed
+        uint16_t words[AD910X_CMD_WORDS];       // Register data, samples or read words of that command
+        uint16_t addrs[AD910X_CMD_WORDS];       // Register addresses of WRITE_REGS
+        uint8_t last[AD910X_CMD_FRAME_MAX];     // Last response frame, resent for a retried command
+        uint32_t last_len;
+        int16_t last_seq;                       // -1 before the first command
+        uint8_t last_cmd;
+        bool streaming;                         // STREAM_BEGIN opened an SRAM upload
+        uint16_t stream_next;                   // Index of the next expected STREAM_DATA chunk
+};
+#endif
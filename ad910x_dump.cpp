@@ -0,0 +1,111 @@
+/******************************************************************************
+    @file:  ad910x_dump.cpp
+
+    @brief: Implements the framed binary dump of AD910x registers and SRAM.
+            The encoder runs on the SDP-K1, the decoder in host tools.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include "ad910x_dump.h"
+
+//  * @brief CRC-16/CCITT-FALSE (polynomial 0x1021, no reflection)
+//  * @param crc - CRC so far, 0xFFFF for a new frame
+//  * @param data[] - bytes
+//  * @param n - number of bytes
+//  * @return updated CRC
+
+uint16_t AD910x_dump_crc( uint16_t crc, const uint8_t data[], uint32_t n ) {
+    for ( uint32_t i=0; i<n; i++ ) {
+        crc ^= (uint16_t)data[i] << 8;
+        for ( int b=0; b<8; b++ ) {
+            crc = ( crc & 0x8000 ) ? (uint16_t)( ( crc << 1 ) ^ 0x1021 ) : (uint16_t)( crc << 1 );
+        }
+    }
+    return crc;
+}
+
+//  * @brief Encode one dump frame
+//  * @param out[] - output, at least AD910X_DUMP_FRAME_MAX bytes
+//  * @param type - AD910X_DUMP_REGS, AD910X_DUMP_SRAM or AD910X_DUMP_END
+//  * @param dev - device index
+//  * @param addr - address of data[0]
+//  * @param data[] - n words, may be NULL if n is 0
+//  * @param n - number of words, clipped to AD910X_DUMP_WORDS
+//  * @return frame size in bytes
+
+uint32_t AD910x_dump_frame( uint8_t out[], uint8_t type, uint8_t dev, uint16_t addr, const uint16_t data[], uint16_t n ) {
+    uint32_t len = 0;
+    
+    n = ( n > AD910X_DUMP_WORDS ) ? AD910X_DUMP_WORDS : n;
+    out[len++] = AD910X_DUMP_SYNC0;
+    out[len++] = AD910X_DUMP_SYNC1;
+    out[len++] = type;
+    out[len++] = dev;
+    out[len++] = addr & 0xFF;
+    out[len++] = addr >> 8;
+    out[len++] = n & 0xFF;
+    out[len++] = n >> 8;
+    for ( int i=0; i<n; i++ ) {
+        out[len++] = data[i] & 0xFF;
+        out[len++] = data[i] >> 8;
+    }
+    
+    uint16_t crc = AD910x_dump_crc( 0xFFFF, out + 2, len - 2 );
+    out[len++] = crc & 0xFF;
+    out[len++] = crc >> 8;
+    return len;
+}
+
+AD910x_DumpDecoder::AD910x_DumpDecoder() : type( 0 ), dev( 0 ), addr( 0 ), n( 0 ), crc_errors( 0 ), len( 0 ), need( 0 ) {
+}
+
+//  * @brief Consume one byte of a dump stream. Bytes outside frames are ignored;
+//  *        after a bad frame the parser searches for the next sync pattern.
+//  * @param byte - next byte
+//  * @return true if the byte completed a valid frame (see type, dev, addr, n, data)
+
+bool AD910x_DumpDecoder::feed( uint8_t byte ) {
+    if ( ( len == 0 && byte != AD910X_DUMP_SYNC0 ) || ( len == 1 && byte != AD910X_DUMP_SYNC1 ) ) {
+        len = ( byte == AD910X_DUMP_SYNC0 ) ? 1 : 0;
+        return false;
+    }
+    buf[len++] = byte;
+    
+    if ( len == 8 ) {
+        uint16_t words = buf[6] | buf[7] << 8;
+        if ( words > AD910X_DUMP_WORDS || buf[2] < AD910X_DUMP_REGS || buf[2] > AD910X_DUMP_END ) {
+            crc_errors++;
+            len = 0;
+            return false;
+        }
+        need = AD910X_DUMP_OVERHEAD + 2 * words;
+    }
+    if ( len < 8 || len < need ) {
+        return false;
+    }
+    
+    len = 0;
+    uint16_t crc = buf[need - 2] | buf[need - 1] << 8;
+    if ( AD910x_dump_crc( 0xFFFF, buf + 2, need - 4 ) != crc ) {
+        crc_errors++;
+        return false;
+    }
+    type = buf[2];
+    dev = buf[3];
+    addr = buf[4] | buf[5] << 8;
+    n = buf[6] | buf[7] << 8;
+    for ( int i=0; i<n; i++ ) {
+        data[i] = buf[8 + 2 * i] | buf[9 + 2 * i] << 8;
+    }
+    return true;
+}
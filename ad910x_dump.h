@@ -0,0 +1,71 @@
+/******************************************************************************
+    @file:  ad910x_dump.h
+
+    @brief: Defines the framed binary dump of AD910x registers and SRAM
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_dump_h__
+#define __ad910x_dump_h__
+#include <stdint.h>
+
+/*** Dump frame, multi-byte fields little-endian:
+       0xA5 0x5A            sync
+       type                 AD910X_DUMP_REGS, AD910X_DUMP_SRAM or AD910X_DUMP_END
+       dev                  device index
+       addr (2)             SPI/SRAM address of the first word
+       n (2)                number of words, at most AD910X_DUMP_WORDS
+       data (2 * n)         words as read (SRAM in wire format)
+       crc (2)              CRC-16/CCITT-FALSE of type .. data ***/
+#define AD910X_DUMP_SYNC0       0xA5
+#define AD910X_DUMP_SYNC1       0x5A
+#define AD910X_DUMP_REGS        0x01            // Run of consecutive registers
+#define AD910X_DUMP_SRAM        0x02            // Run of SRAM words
+#define AD910X_DUMP_END         0x03            // Last frame of a dump; addr holds the number of data frames
+#define AD910X_DUMP_WORDS       256             // Words per frame
+#define AD910X_DUMP_OVERHEAD    10              // Sync, header and CRC bytes of a frame
+#define AD910X_DUMP_FRAME_MAX   ( AD910X_DUMP_OVERHEAD + 2 * AD910X_DUMP_WORDS )
+
+// Byte sink of a dump, e.g. a UART at a higher baud rate; returns 0 on success
+typedef int (*AD910x_DumpWrite)( void *ctx, const uint8_t data[], uint32_t n );
+
+// CRC-16/CCITT-FALSE of n bytes, continuing from crc (start with 0xFFFF)
+uint16_t AD910x_dump_crc( uint16_t crc, const uint8_t data[], uint32_t n );
+
+// Encode one frame into out[] (AD910X_DUMP_FRAME_MAX bytes); returns its size
+uint32_t AD910x_dump_frame( uint8_t out[], uint8_t type, uint8_t dev, uint16_t addr, const uint16_t data[], uint16_t n );
+
+/*** Frame parser of a dump byte stream; resynchronizes after corrupt frames ***/
+class AD910x_DumpDecoder {
+    public:
+        AD910x_DumpDecoder();
+
+        // Consume one byte; true when it completed a frame with a valid CRC
+        bool feed( uint8_t byte );
+
+        /*** Last complete frame ***/
+        uint8_t type;
+        uint8_t dev;
+        uint16_t addr;
+        uint16_t n;
+        uint16_t data[AD910X_DUMP_WORDS];
+
+        uint32_t crc_errors;        // Frames dropped because of a CRC mismatch or bad header
+
+    private:
+        uint8_t buf[AD910X_DUMP_FRAME_MAX];
+        uint32_t len;               // Bytes of the current frame received
+        uint32_t need;              // Size of the current frame, 0 while the header is incomplete
+};
+#endif
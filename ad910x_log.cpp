@@ -0,0 +1,94 @@
+/******************************************************************************
+    @file:  ad910x_log.cpp
+ 
+    @brief: Implements the record queue of deferred AD910x diagnostic output
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+#include "ad910x_log.h"
+
+AD910x_LogQueue::AD910x_LogQueue() : head( 0 ), tail( 0 ), dropped( 0 ), reported( 0 ), sleeping( false ), wake( NULL ), wake_ctx( NULL ) {
+}
+
+//  * @brief Queue a record without blocking, and wake the drain thread if it
+//  *        sleeps. head is published before sleeping is read, and idle()
+//  *        sets sleeping before it reads head, so one of the two sees the
+//  *        other and no record is left waiting for a wake-up.
+//  * @param addr - SPI/SRAM register address
+//  * @param data - 16-bit data
+//  * @return false if the ring was full and the record was dropped
+
+bool AD910x_LogQueue::push( uint16_t addr, uint16_t data ) {
+    uint32_t h = head.load( std::memory_order_relaxed );
+    
+    if ( h - tail.load( std::memory_order_acquire ) >= AD910X_LOG_DEPTH ) {
+        dropped.fetch_add( 1, std::memory_order_relaxed );
+        return false;
+    }
+    
+    ring[h % AD910X_LOG_DEPTH].addr = addr;
+    ring[h % AD910X_LOG_DEPTH].data = data;
+    head.store( h + 1 );
+    
+    if ( sleeping.load() && sleeping.exchange( false ) && wake != NULL ) {
+        wake( wake_ctx );
+    }
+    return true;
+}
+
+//  * @brief Take the oldest record
+//  * @param rec - record output
+//  * @return false if the ring is empty
+
+bool AD910x_LogQueue::pop( AD910x_LogRecord &rec ) {
+    uint32_t t = tail.load( std::memory_order_relaxed );
+    
+    if ( t == head.load( std::memory_order_acquire ) ) {
+        return false;
+    }
+    
+    rec = ring[t % AD910X_LOG_DEPTH];
+    tail.store( t + 1, std::memory_order_release );
+    
+    return true;
+}
+
+bool AD910x_LogQueue::empty() const {
+    return tail.load( std::memory_order_acquire ) == head.load( std::memory_order_acquire );
+}
+
+//  * @brief Mark the drain thread asleep once it has printed everything. It
+//  *        may then wait for the on_push() function to wake it.
+//  * @param none
+//  * @return true if the queue is still empty, false if records arrived and
+//  *         the drain thread must pop them first
+
+bool AD910x_LogQueue::idle() {
+    sleeping.store( true );
+    if ( tail.load( std::memory_order_relaxed ) == head.load() ) {
+        return true;
+    }
+    sleeping.store( false );
+    return false;
+}
+
+//  * @brief Count records dropped since the last call (consumer side)
+//  * @param none
+//  * @return number of dropped records
+
+uint32_t AD910x_LogQueue::take_dropped() {
+    uint32_t total = dropped.load( std::memory_order_relaxed );
+    uint32_t n = total - reported;
+    reported = total;
+    return n;
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+    @file:  ad910x_log.h
+ 
+    @brief: Defines the record queue of deferred AD910x diagnostic output
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+
+#ifndef __ad910x_log_h__
+#define __ad910x_log_h__
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+/*** Diagnostic output levels (AD910x_BASE::log_level) ***/
+#define AD910X_LOG_OFF          0       // No output, no read-back for display
+#define AD910X_LOG_SUMMARY      1       // One line per register update or SRAM read
+#define AD910X_LOG_FULL         2       // Every register/SRAM word printed as it is read
+#define AD910X_LOG_DEFERRED     3       // Every word queued as a binary record and printed by a drain thread
+
+#define AD910X_LOG_DEPTH        512     // Records held by AD910x_LogQueue (power of two)
+
+/*** One address/data pair of deferred output ***/
+struct AD910x_LogRecord {
+    uint16_t addr;
+    uint16_t data;
+};
+
+// Wake-up of a sleeping drain thread, called from push()
+typedef void (*AD910x_LogWake)( void *ctx );
+
+/*** Single-producer/single-consumer ring of log records.
+     The driver pushes from its thread, one drain thread pops. ***/
+class AD910x_LogQueue {
+    public:
+        AD910x_LogQueue();
+
+        // Set the function push() calls when the drain thread sleeps
+        void on_push( AD910x_LogWake fn, void *ctx ) { wake = fn; wake_ctx = ctx; }
+
+        // Queue a record; counts it as dropped if the ring is full
+        bool push( uint16_t addr, uint16_t data );
+
+        // Take the oldest record
+        bool pop( AD910x_LogRecord &rec );
+
+        // Check whether all records were drained
+        bool empty() const;
+
+        // Consumer: mark the drain thread asleep; false if records arrived and it must drain again
+        bool idle();
+
+        // Check whether the drain thread has printed every record and sleeps
+        bool drained() const { return sleeping.load() && empty(); }
+
+        // Return and clear the number of dropped records
+        uint32_t take_dropped();
+
+    private:
+        AD910x_LogRecord ring[AD910X_LOG_DEPTH];
+        std::atomic<uint32_t> head;     // Written by the producer only
+        std::atomic<uint32_t> tail;     // Written by the consumer only
+        std::atomic<uint32_t> dropped;  // Written by the producer only
+        uint32_t reported;              // Dropped records already returned to the consumer
+        std::atomic<bool> sleeping;     // Set by idle(), cleared by the push that wakes the consumer
+        AD910x_LogWake wake;
+        void *wake_ctx;
+};
+#endif
@@ -0,0 +1,113 @@
+/******************************************************************************
+    @file:  ad910x_parallel.cpp
+
+    @brief: Implements concurrent configuration of AD910x boards spread over
+            several independent SPI buses. Uses one mbed thread per bus on
+            target and std::thread on the host.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include "ad910x_parallel.h"
+
+#if defined( __MBED__ )
+#include "mbed.h"
+#else
+#include <thread>
+#endif
+
+/*** Job of one worker ***/
+struct AD910x_BusTask {
+    AD910x_BusJob job;
+    void *ctx;
+    uint8_t bus;
+};
+
+static void bus_worker( AD910x_BusTask *task ) {
+    task->job( task->ctx, task->bus );
+}
+
+//  * @param drivers[] - one driver per SPI bus; drivers[0] drives the shared trigger pin
+//  * @param n - number of buses, at most AD910X_MAX_BUSES
+
+AD910x_Parallel::AD910x_Parallel( AD910x_BASE *const drivers[], uint8_t n ) : num_buses( 0 ) {
+    for ( int i=0; i<n && i<AD910X_MAX_BUSES; i++ ) {
+        bus_driver[num_buses++] = drivers[i];
+    }
+}
+
+//  * @brief Run one configuration job per bus concurrently. Bus 0 runs in the
+//  *        calling thread; the call returns after every job has finished, so
+//  *        the boards are ready for AD910x_start_pattern().
+//  * @param job - job run for every bus; must only use the driver of its bus
+//  * @param ctx - argument passed to job
+//  * @return none
+
+void AD910x_Parallel::run( AD910x_BusJob job, void *ctx ) {
+    AD910x_BusTask task[AD910X_MAX_BUSES];
+    for ( int b=0; b<num_buses; b++ ) {
+        task[b] = { job, ctx, (uint8_t)b };
+    }
+
+#if defined( __MBED__ )
+    Thread *worker[AD910X_MAX_BUSES];
+    for ( int b=1; b<num_buses; b++ ) {
+        worker[b] = new Thread( osPriorityNormal, AD910X_WORKER_STACK );
+        worker[b]->start( callback( bus_worker, &task[b] ) );
+    }
+    if ( num_buses != 0 ) {
+        bus_worker( &task[0] );
+    }
+    for ( int b=1; b<num_buses; b++ ) {
+        worker[b]->join();
+        delete worker[b];
+    }
+#else
+    std::thread worker[AD910X_MAX_BUSES];
+    for ( int b=1; b<num_buses; b++ ) {
+        worker[b] = std::thread( bus_worker, &task[b] );
+    }
+    if ( num_buses != 0 ) {
+        bus_worker( &task[0] );
+    }
+    for ( int b=1; b<num_buses; b++ ) {
+        worker[b].join();
+    }
+#endif
+}
+
+//  * @brief Reset the devices of every bus. A reset pin shared by all boards
+//  *        belongs to bus 0; the other drivers only reload their shadows.
+//  * @param none
+//  * @return none
+
+void AD910x_Parallel::AD910x_reg_reset() {
+    for ( int b=0; b<num_buses; b++ ) {
+        bus_driver[b]->AD910x_reg_reset();
+    }
+}
+
+//  * @brief Start pattern generation of every board at once
+//  * @param none
+//  * @return none
+
+void AD910x_Parallel::AD910x_start_pattern() {
+    bus_driver[0]->AD910x_start_pattern();
+}
+
+//  * @brief Stop pattern generation of every board at once
+//  * @param none
+//  * @return none
+
+void AD910x_Parallel::AD910x_stop_pattern() {
+    bus_driver[0]->AD910x_stop_pattern();
+}
@@ -0,0 +1,50 @@
+/******************************************************************************
+    @file:  ad910x_parallel.h
+
+    @brief: Defines concurrent configuration of AD910x boards spread over
+            several independent SPI buses
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_parallel_h__
+#define __ad910x_parallel_h__
+#include <stdint.h>
+#include "ad910x.h"
+
+#define AD910X_MAX_BUSES        6               // SPI controllers of the SDP-K1 MCU
+#define AD910X_WORKER_STACK     2048            // Stack bytes of each mbed worker thread
+
+// Configuration job of one bus, run by the worker of that bus
+typedef void (*AD910x_BusJob)( void *ctx, uint8_t bus );
+
+/*** One driver per SPI bus; the bus of drivers[0] owns the shared trigger pin ***/
+class AD910x_Parallel {
+    public:
+        AD910x_Parallel( AD910x_BASE *const drivers[], uint8_t n );
+
+        // Run job( ctx, b ) for every bus b concurrently and return when all have finished
+        void run( AD910x_BusJob job, void *ctx );
+
+        // Reset the devices of every bus
+        void AD910x_reg_reset();
+
+        // Start/stop pattern generation of every board with the shared trigger
+        void AD910x_start_pattern();
+        void AD910x_stop_pattern();
+
+    private:
+        AD910x_BASE *bus_driver[AD910X_MAX_BUSES];
+        uint8_t num_buses;
+};
+#endif
@@ -0,0 +1,134 @@
+/******************************************************************************
+    @file:  ad910x_preset.cpp
+
+    @brief: Implements a library of named pattern presets. A switch goes
+            through the register and SRAM shadows of the driver, so only the
+            registers and SRAM words that differ from the current device
+            state are sent.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <string.h>
+#include "ad910x_preset.h"
+
+//  * @param driver - driver of the devices
+//  * @param dev_mask - devices switched together (0x1 for AD910x_SINGLE)
+
+AD910x_PresetLib::AD910x_PresetLib( AD910x_BASE &driver, uint32_t dev_mask ) :
+        num_slots( 0 ), dev( driver ), mask( dev_mask ), current( AD910X_PRESET_NONE ) {
+    memset( cost, 0, sizeof( cost ) );
+}
+
+//  * @brief Store a preset. Only the pointers are copied; the register set
+//  *        and SRAM image must stay valid as long as the library is used.
+//  * @param preset - preset with a register set
+//  * @return slot index, -1 if the library is full or preset has no register set
+
+int AD910x_PresetLib::add( const AD910x_Preset &preset ) {
+    if ( num_slots == AD910X_PRESET_SLOTS || preset.regval == NULL ) {
+        return -1;
+    }
+    slot[num_slots] = preset;
+    return num_slots++;
+}
+
+//  * @brief Look up a preset by name
+//  * @param name - preset name
+//  * @return slot index, -1 if no preset has that name
+
+int AD910x_PresetLib::find( const char *name ) const {
+    for ( int i=0; i<num_slots; i++ ) {
+        if ( slot[i].name != NULL && strcmp( slot[i].name, name ) == 0 ) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//  * @brief Switch the devices to a preset. The SRAM ranges the preset plays
+//  *        and its register set are written with diff_en and reg_cache_en
+//  *        forced on, so a switch between presets sharing an SRAM image costs
+//  *        only the registers that differ. Writes made outside the library
+//  *        are in the shadows too and are undone where the preset differs.
+//  *        The latency and traffic of the switch are kept per transition.
+//  * @param n - slot index
+//  * @return switch latency in microseconds (0 if the transport has no clock),
+//  *         -1 if the slot is empty, an asynchronous SRAM upload is running
+//  *         or the SRAM write was refused; after a refused write the state
+//  *         of the devices is unknown (active() returns AD910X_PRESET_NONE)
+
+int32_t AD910x_PresetLib::select( uint8_t n ) {
+    if ( n >= num_slots || dev.AD910x_sram_busy() ) {
+        return -1;
+    }
+    const AD910x_Preset &p = slot[n];
+    bool diff = dev.diff_en;
+    bool cache = dev.reg_cache_en;
+    uint32_t regs = dev.stats.reg_written;
+    uint32_t sram = dev.stats.sram_written;
+    uint32_t t0 = dev.bus.time_us();
+
+    dev.diff_en = true;
+    dev.reg_cache_en = true;
+    if ( p.trigger == AD910X_TRIG_RESTART ) {
+        dev.AD910x_stop_pattern();
+    }
+    int loaded = 0;
+    if ( p.sram != NULL ) {
+        loaded = dev.dev_update_sram_used( mask, p.sram, p.regval );
+    } else if ( p.packed != NULL ) {
+        loaded = dev.dev_update_sram_packed( mask, *p.packed );
+    }
+    if ( loaded < 0 ) {
+        dev.diff_en = diff;
+        dev.reg_cache_en = cache;
+        current = AD910X_PRESET_NONE;
+        return -1;
+    }
+    dev.dev_update_regs( mask, p.regval );
+    if ( p.trigger != AD910X_TRIG_KEEP ) {
+        dev.AD910x_start_pattern();
+    }
+    uint32_t us = dev.bus.time_us() - t0;
+    dev.diff_en = diff;
+    dev.reg_cache_en = cache;
+
+    AD910x_Transition &t = cost[( current == AD910X_PRESET_NONE ) ? AD910X_PRESET_SLOTS : current][n];
+    t.us = us;
+    t.regs = (uint16_t)( dev.stats.reg_written - regs );
+    t.sram = (uint16_t)( dev.stats.sram_written - sram );
+    current = n;
+    return (int32_t)us;
+}
+
+//  * @brief Switch the devices to a preset given by name
+//  * @param name - preset name
+//  * @return as select( slot ), -1 if no preset has that name
+
+int32_t AD910x_PresetLib::select( const char *name ) {
+    int n = find( name );
+    return ( n < 0 ) ? -1 : select( (uint8_t)n );
+}
+
+//  * @brief Look up the cost of the last switch between two slots
+//  * @param from - slot switched from, AD910X_PRESET_NONE for an unknown state
+//  * @param to - slot switched to
+//  * @return latency and traffic, all 0 if that switch never happened
+
+const AD910x_Transition &AD910x_PresetLib::transition( uint8_t from, uint8_t to ) const {
+    static const AD910x_Transition none = { 0, 0, 0 };
+    if ( to >= AD910X_PRESET_SLOTS || ( from >= AD910X_PRESET_SLOTS && from != AD910X_PRESET_NONE ) ) {
+        return none;
+    }
+    return cost[( from == AD910X_PRESET_NONE ) ? AD910X_PRESET_SLOTS : from][to];
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+    @file:  ad910x_preset.h
+
+    @brief: Defines a library of named pattern presets that are switched by
+            sending only what differs from the current device state
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_preset_h__
+#define __ad910x_preset_h__
+#include <stdint.h>
+#include "ad910x.h"
+
+#define AD910X_PRESET_SLOTS     8               // Presets held by one library
+#define AD910X_PRESET_NONE      0xFF            // Slot index of an unknown device state
+
+/*** Trigger handling of a preset switch (AD910x_Preset::trigger) ***/
+#define AD910X_TRIG_KEEP        0               // Leave the trigger pin alone; a running pattern takes the new set at RAMUPDATE
+#define AD910X_TRIG_START       1               // Start pattern generation after loading
+#define AD910X_TRIG_RESTART     2               // Stop pattern generation before loading, start it after
+
+/*** One resident pattern: the data stays where it is (flash), the library keeps pointers ***/
+struct AD910x_Preset {
+    const char *name;
+    const uint16_t *regval;                     // 66 register values in reg_add order
+    const int16_t *sram;                        // Full SRAM image, only the ranges played by regval are written; NULL if unused
+    const AD910x_PackedWave *packed;            // Packed SRAM image, used if sram is NULL; both NULL keep SRAM as it is
+    uint8_t trigger;                            // AD910X_TRIG_*
+};
+
+/*** Cost of the last switch between two slots ***/
+struct AD910x_Transition {
+    uint32_t us;                                // Switch latency, 0 if never switched or the transport has no clock
+    uint16_t regs;                              // Registers written
+    uint16_t sram;                              // SRAM words written
+};
+
+/*** Presets of the devices in one dev_mask of a driver ***/
+class AD910x_PresetLib {
+    public:
+        AD910x_PresetLib( AD910x_BASE &driver, uint32_t dev_mask );
+
+        // Store a preset in the next free slot; returns the slot or -1 if the library is full
+        int add( const AD910x_Preset &preset );
+
+        // Slot of a preset name, -1 if not found
+        int find( const char *name ) const;
+
+        // Switch the devices to a preset; returns the latency in microseconds or -1
+        int32_t select( uint8_t slot );
+        int32_t select( const char *name );
+
+        // Forget the current preset, e.g. after the registers were written directly
+        void invalidate() { current = AD910X_PRESET_NONE; }
+
+        // Slot the devices were last switched to, AD910X_PRESET_NONE if unknown
+        uint8_t active() const { return current; }
+
+        // Cost of the last switch from one slot to another; from = AD910X_PRESET_NONE for a switch from an unknown state
+        const AD910x_Transition &transition( uint8_t from, uint8_t to ) const;
+
+        uint8_t num_slots;                      // Slots in use
+        AD910x_Preset slot[AD910X_PRESET_SLOTS];
+
+    private:
+        AD910x_BASE &dev;
+        uint32_t mask;
+        uint8_t current;
+        AD910x_Transition cost[AD910X_PRESET_SLOTS + 1][AD910X_PRESET_SLOTS];  // Last row: from an unknown state
+};
+#endif
@@ -0,0 +1,71 @@
+/******************************************************************************
+    @file:  ad910x_regs.h
+
+    @brief: Defines AD910x SPI protocol constants, register addresses and
+            register values after reset
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_regs_h__
+#define __ad910x_regs_h__
+#include <stdint.h>
+
+/*** SPI instruction word ***/
+#define AD910X_SPI_READ         0x8000          // R/W bit of the instruction word
+#define AD910X_SPI_ADDR_MASK    0x7FFF          // Address bits of the instruction word
+
+/*** SPI register addresses ***/
+#define AD910X_REG_SPICONFIG    0x0000
+#define AD910X_REG_RAMUPDATE    0x001D
+#define AD910X_REG_PAT_STATUS   0x001E
+#define AD910X_REG_DOF( ch )    ( 0x0025 - ( ch ) )   // DACx_DOF digital offset of channel ch = 0..3 (DAC1..DAC4), bits 15:4
+#define AD910X_REG_PAT_PERIOD   0x0029
+#define AD910X_REG_DGAIN( ch )  ( 0x0035 - ( ch ) )   // DACx_DGAIN digital gain of channel ch, bits 15:4
+#define AD910X_REG_DDS_TW32     0x003E          // DDS tuning word bits 23:8
+#define AD910X_REG_DDS_TW1      0x003F          // DDS tuning word bits 7:0, in bits 15:8
+#define AD910X_REG_DDS_PW( ch ) ( 0x0043 - ( ch ) )   // DDSx_PW phase offset of channel ch = 0..3 (DAC1..DAC4)
+#define AD910X_REG_START_ADDR( ch ) ( 0x005D - 4 * ( ch ) )   // START_ADDRx of channel ch = 0..3 (DAC1..DAC4)
+#define AD910X_REG_STOP_ADDR( ch )  ( 0x005E - 4 * ( ch ) )   // STOP_ADDRx, last SRAM word played
+#define AD910X_REG_CFG_ERROR    0x0060
+#define AD910X_REG_SPACE        0x0080          // Size of the modeled register address space
+
+/*** PAT_STATUS (0x001E) bits ***/
+#define AD910X_PAT_RUN          0x0001
+#define AD910X_MEM_ACCESS       0x0004          // SPI owns the SRAM
+#define AD910X_BUF_READ         0x0008          // SRAM reads return memory contents
+
+/*** SRAM ***/
+#define AD910X_SRAM_ADDR        0x6000
+#define AD910X_SRAM_SIZE        4096
+#define AD910X_SRAM_ADDR_SHIFT  4               // START_ADDRx/STOP_ADDRx hold the SRAM word in bits 15:4
+#define AD910X_CHAN_SHIFT       4               // DACx_DGAIN/DACx_DOF hold a 12-bit two's complement value in bits 15:4
+#define AD910X_DGAIN_UNITY      0x400           // DACx_DGAIN value of gain 1.0 (range -2.0 to +2.0)
+#define AD910X_CHANNELS         4
+
+/*** Register values after AD910x_reg_reset (registers not listed reset to 0x0000) ***/
+struct AD910x_RegDefault {
+    uint16_t addr;
+    uint16_t val;
+};
+
+static const AD910x_RegDefault AD910X_REG_DEFAULTS[] = {
+    {0x0009, 0x000A}, {0x000A, 0x000A}, {0x000B, 0x000A}, {0x000C, 0x000A},     // DACx_RSET
+    {0x0020, 0x000E},                                                           // PATTERN_DLY
+    {0x0028, 0x0111},                                                           // PAT_TIMEBASE
+    {0x0029, 0x8000},                                                           // PAT_PERIOD
+    {0x002A, 0x0101}, {0x002B, 0x0101},                                         // DACx_PATx
+    {0x002C, 0x0003},                                                           // DOUT_START_DLY
+    {0x0053, 0x0001}, {0x0057, 0x0001}, {0x005B, 0x0001}, {0x005F, 0x0001}      // DDS_CYCx
+};
+#endif
@@ -0,0 +1,177 @@
+/******************************************************************************
+    @file:  ad910x_spi.cpp
+ 
+    @brief: Implements the mbed SPI transport of the AD910x driver
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+#include "mbed.h"
+#include "ad910x_spi.h"
+
+AD910x_SPI::AD910x_SPI( PinName CSB1,
+               PinName CSB2,
+               PinName MOSI,
+               PinName MISO,
+               PinName SCK,
+               PinName RESETB,
+               PinName TRIGGERB ) :
+               spi( MOSI, MISO, SCK ), csb1( CSB1, 1 ), csb2( CSB2, 1 ), resetb( RESETB ), triggerb( TRIGGERB ), num_more( 0 ) {
+}
+
+AD910x_SPI::AD910x_SPI( const PinName CSB[],
+               uint8_t n,
+               PinName MOSI,
+               PinName MISO,
+               PinName SCK,
+               PinName RESETB,
+               PinName TRIGGERB ) :
+               spi( MOSI, MISO, SCK ), csb1( CSB[0], 1 ), csb2( ( n > 1 ) ? CSB[1] : NC, 1 ), resetb( RESETB ), triggerb( TRIGGERB ),
+               num_more( 0 ) {
+    for ( int i=2; i<n && i<AD910X_MAX_DEVS; i++ ) {
+        csb_more[num_more++] = new DigitalOut( CSB[i], 1 );
+    }
+}
+
+AD910x_SPI::~AD910x_SPI() {
+    for ( int i=0; i<num_more; i++ ) {
+        delete csb_more[i];
+    }
+}
+
+//  * @brief Set SPI word length and mode
+//  * @param reg_len - SPI word length
+//  * @param mode - SPI clock polarity, clock and data phase
+//  * @return none
+
+void AD910x_SPI::format( uint8_t reg_len, uint8_t mode ) {
+    spi.format( reg_len, mode );
+}
+
+//  * @brief Set SPI bus frequency
+//  * @param hz - SPI bus frequency in hz
+//  * @return none
+
+void AD910x_SPI::frequency( uint32_t hz ) {
+    spi.frequency( hz );
+}
+
+//  * @brief Assert chip select pins of the selected devices
+//  * @param dev_mask - bit 0 selects device 1, bit 1 selects device 2, bit n device n+1
+//  * @return none
+
+void AD910x_SPI::select( uint32_t dev_mask ) {
+    if ( dev_mask & 0x1 ) {
+        csb1 = 0;
+    }
+    if ( ( dev_mask & 0x2 ) && csb2.is_connected() ) {
+        csb2 = 0;
+    }
+    for ( int i=0; i<num_more; i++ ) {
+        if ( dev_mask & ( 4u << i ) ) {
+            *csb_more[i] = 0;
+        }
+    }
+}
+
+//  * @brief Release all chip select pins
+//  * @param none
+//  * @return none
+
+void AD910x_SPI::deselect() {
+    csb1 = 1;
+    if ( csb2.is_connected() ) {
+        csb2 = 1;
+    }
+    for ( int i=0; i<num_more; i++ ) {
+        *csb_more[i] = 1;
+    }
+}
+
+//  * @brief Send one SPI frame
+//  * @param frame - frame shifted out on MOSI
+//  * @return frame shifted in on MISO
+
+uint16_t AD910x_SPI::write( uint16_t frame ) {
+    return spi.write( frame );
+}
+
+//  * @brief Send n SPI frames in one block transfer (single SPI lock, no per-frame call overhead)
+//  * @param frames[] - frames shifted out on MOSI
+//  * @param n - number of frames
+//  * @return none
+
+void AD910x_SPI::write_block( const uint16_t frames[], uint32_t n ) {
+    spi.write( (const char *)frames, n * sizeof( uint16_t ), NULL, 0 );
+}
+
+#if DEVICE_SPI_ASYNCH
+//  * @brief Start a DMA block transfer of n SPI frames
+//  * @param frames[] - frames shifted out on MOSI; must stay valid until cb runs
+//  * @param n - number of frames
+//  * @param cb - completion callback, runs in interrupt context
+//  * @param ctx - argument passed to cb
+//  * @return 0 if the transfer started
+
+int AD910x_SPI::write_block_async( const uint16_t frames[], uint32_t n, AD910x_Callback cb, void *ctx ) {
+    async_cb = cb;
+    async_ctx = ctx;
+    
+    spi.set_dma_usage( DMA_USAGE_ALWAYS );
+    return spi.transfer( frames, n * sizeof( uint16_t ), (uint16_t *)NULL, 0,
+            callback( this, &AD910x_SPI::transfer_done ), SPI_EVENT_COMPLETE | SPI_EVENT_ERROR );
+}
+
+//  * @brief SPI event handler of write_block_async
+//  * @param event - mbed SPI event flags
+//  * @return none
+
+void AD910x_SPI::transfer_done( int event ) {
+    async_cb( async_ctx, ( event & SPI_EVENT_ERROR ) ? AD910X_EVENT_ERROR : AD910X_EVENT_COMPLETE );
+}
+#endif
+
+//  * @brief Busy-wait
+//  * @param us - delay in microseconds
+//  * @return none
+
+void AD910x_SPI::delay_us( uint32_t us ) {
+    wait_us( us );
+}
+
+//  * @brief Read the microsecond ticker
+//  * @param none
+//  * @return ticker value in microseconds, wrapping every 71 minutes
+
+uint32_t AD910x_SPI::time_us() {
+    return us_ticker_read();
+}
+
+//  * @brief Drive AD910x reset pin (no-op if RESETB is NC, e.g. a shared pin owned by another bus)
+//  * @param level - pin level
+//  * @return none
+
+void AD910x_SPI::set_reset( int level ) {
+    if ( resetb.is_connected() ) {
+        resetb = level;
+    }
+}
+
+//  * @brief Drive AD910x trigger pin (no-op if TRIGGERB is NC)
+//  * @param level - pin level
+//  * @return none
+
+void AD910x_SPI::set_trigger( int level ) {
+    if ( triggerb.is_connected() ) {
+        triggerb = level;
+    }
+}
@@ -0,0 +1,67 @@
+/******************************************************************************
+    @file:  ad910x_spi.h
+ 
+    @brief: Defines the mbed SPI transport and digital pins of the AD910x
+            evaluation boards
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+
+#ifndef __ad910x_spi_h__
+#define __ad910x_spi_h__
+#include "mbed.h"
+#include "ad910x_transport.h"
+
+class AD910x_SPI : public AD910x_Transport {
+    public:
+        SPI( spi );             // SPI instance of AD910x
+        DigitalOut( csb1 );     // DigitalOut instance for AD910x device 1 chip select pin
+        DigitalOut( csb2 );     // DigitalOut instance for AD910x device 2 chip select pin (NC on single-board)
+        DigitalOut( resetb );   // DigitalOut instance for AD910x reset pin
+        DigitalOut( triggerb ); // DigitalOut instance for AD910x trigger pin
+
+        /*** 4-Wire SPI, Reset, and Trigger configuration & constructor ***/
+        AD910x_SPI( PinName CSB1 = PA_15, PinName CSB2 = NC, PinName MOSI = PA_7, PinName MISO = PB_4, PinName SCK = PB_3,
+                PinName RESETB = PG_11, PinName TRIGGERB = PG_10 );
+
+        /*** Same for n devices: CSB[0] drives csb1, CSB[1] csb2, the rest are allocated ***/
+        AD910x_SPI( const PinName CSB[], uint8_t n, PinName MOSI = PA_7, PinName MISO = PB_4, PinName SCK = PB_3,
+                PinName RESETB = PG_11, PinName TRIGGERB = PG_10 );
+        ~AD910x_SPI();
+
+        void format( uint8_t reg_len, uint8_t mode );
+        void frequency( uint32_t hz );
+        void select( uint32_t dev_mask );
+        void deselect();
+        uint16_t write( uint16_t frame );
+        void write_block( const uint16_t frames[], uint32_t n );
+#if DEVICE_SPI_ASYNCH
+        int write_block_async( const uint16_t frames[], uint32_t n, AD910x_Callback cb, void *ctx );
+#endif
+        void delay_us( uint32_t us );
+        uint32_t time_us();
+        void set_reset( int level );
+        void set_trigger( int level );
+
+    private:
+        DigitalOut *csb_more[AD910X_MAX_DEVS - 2];  // Chip selects of devices 3 and up
+        uint8_t num_more;
+
+#if DEVICE_SPI_ASYNCH
+        AD910x_Callback async_cb;   // Completion callback of the running block transfer
+        void *async_ctx;
+
+        void transfer_done( int event );
+#endif
+};
+#endif
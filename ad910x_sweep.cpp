@@ -0,0 +1,396 @@
+/******************************************************************************
+    @file:  ad910x_sweep.cpp
+
+    @brief: Implements a DDS sweep engine. Tuning and phase words are computed
+            when the table is filled; each step then writes only the DDS
+            registers that change and one RAMUPDATE. Uses an mbed Ticker and
+            thread on target and std::thread on the host.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <string.h>
+#include <math.h>
+#include "ad910x_sweep.h"
+
+#if defined( __MBED__ )
+#include "mbed.h"
+#else
+#include <chrono>
+#endif
+
+//  * @brief Read the microsecond clock of the cadence measurements
+//  * @param none
+//  * @return time in microseconds, wrapping
+
+static uint32_t now_us() {
+#if defined( __MBED__ )
+    return us_ticker_read();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+}
+
+//  * @param driver - driver of the devices; used by the sweep thread while the timer runs
+//  * @param dev_mask - devices swept together (0x1 for AD910x_SINGLE)
+//  * @param dac_hz - DAC clock, the reference of the DDS tuning word
+//  * @param worker - started worker of driver, NULL if the sweep is its only user
+
+AD910x_Sweep::AD910x_Sweep( AD910x_BASE &driver, uint32_t dev_mask, uint32_t dac_hz, AD910x_Worker *worker ) :
+        num_steps( 0 ), pos( 0 ), stats(), dev( driver ), bus( worker ), mask( dev_mask ), dac_clk( dac_hz ), phase_mask( 0 ),
+        primed( false ), period( 0 ), repeat( false ), active( false )
+#if defined( __MBED__ )
+        , thread( osPriorityRealtime, AD910X_SWEEP_STACK ), ended( 0, 1 ), launched( false ), pending( false )
+#endif
+        {
+    job.type = AD910X_JOB_CALL;
+    job.call = run_step;
+    job.ctx = this;
+}
+
+AD910x_Sweep::~AD910x_Sweep() {
+    stop();
+}
+
+#pragma region (TABLE)
+//  * @brief Convert a frequency to a DDS tuning word: f = TW * dac_hz / 2^24
+//  * @param hz - output frequency, clamped to 0..dac_hz
+//  * @param dac_hz - DAC clock
+//  * @return 24-bit tuning word
+
+uint32_t AD910x_Sweep::tuning_word( float hz, uint32_t dac_hz ) {
+    if ( hz <= 0 || dac_hz == 0 ) {
+        return 0;
+    }
+    double tw = (double)hz * 16777216.0 / dac_hz + 0.5;
+    return ( tw >= 16777215.0 ) ? 0xFFFFFF : (uint32_t)tw;
+}
+
+//  * @brief Fill the sweep table with a linear chirp. The DDS keeps its phase
+//  *        across tuning word changes, so the output stays continuous.
+//  * @param f_start - frequency of the first step in Hz
+//  * @param f_stop - frequency of the last step in Hz
+//  * @param n - number of steps, 2..AD910X_SWEEP_STEPS
+//  * @return n, -1 if n is out of range or the timer is running
+
+int AD910x_Sweep::chirp( float f_start, float f_stop, uint16_t n ) {
+    if ( n < 2 || n > AD910X_SWEEP_STEPS || active.load() ) {
+        return -1;
+    }
+    for ( int i=0; i<n; i++ ) {
+        uint32_t tw = tuning_word( f_start + ( f_stop - f_start ) * i / ( n - 1 ), dac_clk );
+        steps[i].tw32 = (uint16_t)( tw >> 8 );
+        steps[i].tw1 = (uint16_t)( ( tw & 0xFF ) << 8 );
+        steps[i].pw = 0;
+    }
+    num_steps = n;
+    phase_mask = 0;
+    mark_changes();
+    return n;
+}
+
+//  * @brief Fill the sweep table with a list of frequencies and phases, e.g.
+//  *        a stepped-frequency sweep or a phase-coded sequence
+//  * @param freq_hz[] - frequency of each step in Hz
+//  * @param phase_deg[] - phase offset of each step in degrees, NULL to leave DDSx_PW alone
+//  * @param n - number of steps, 1..AD910X_SWEEP_STEPS
+//  * @param phase_ch - channels whose DDSx_PW takes the phase, bit 0 = DAC1
+//  * @return n, -1 if n is out of range or the timer is running
+
+int AD910x_Sweep::table( const float freq_hz[], const float phase_deg[], uint16_t n, uint8_t phase_ch ) {
+    if ( n == 0 || n > AD910X_SWEEP_STEPS || active.load() ) {
+        return -1;
+    }
+    for ( int i=0; i<n; i++ ) {
+        uint32_t tw = tuning_word( freq_hz[i], dac_clk );
+        steps[i].tw32 = (uint16_t)( tw >> 8 );
+        steps[i].tw1 = (uint16_t)( ( tw & 0xFF ) << 8 );
+        if ( phase_deg != NULL ) {
+            double turns = phase_deg[i] / 360.0;
+            turns -= floor( turns );
+            steps[i].pw = (uint16_t)(uint32_t)( turns * 65536.0 + 0.5 );
+        } else {
+            steps[i].pw = 0;
+        }
+    }
+    num_steps = n;
+    phase_mask = ( phase_deg != NULL ) ? ( phase_ch & 0xF ) : 0;
+    mark_changes();
+    return n;
+}
+
+//  * @brief Mark the registers each step changes. Step 0 is compared with the
+//  *        last step, which it follows when the sweep loops; the very first
+//  *        step after filling the table writes everything.
+//  * @param none
+//  * @return none
+
+void AD910x_Sweep::mark_changes() {
+    for ( int i=0; i<num_steps; i++ ) {
+        const AD910x_SweepStep &prev = steps[( i == 0 ) ? num_steps - 1 : i - 1];
+        steps[i].write = 0;
+        if ( steps[i].tw32 != prev.tw32 || steps[i].tw1 != prev.tw1 ) {
+            steps[i].write |= AD910X_SWEEP_TW;
+        }
+        if ( phase_mask != 0 && steps[i].pw != prev.pw ) {
+            steps[i].write |= AD910X_SWEEP_PW;
+        }
+    }
+    pos = 0;
+    primed = false;
+}
+#pragma endregion
+
+#pragma region (STEP)
+//  * @brief Write the next step of the table and commit it with RAMUPDATE,
+//  *        through the worker if there is one
+//  * @param none
+//  * @return bus time of the step in microseconds (0 if the transport has no
+//  *         clock), -1 if the table is empty or the worker did not take the step
+
+int32_t AD910x_Sweep::step() {
+    if ( bus == NULL ) {
+        return write_step();
+    }
+    if ( bus->submit( job ) != 0 ) {
+        return -1;
+    }
+    return bus->wait( job );
+}
+
+//  * @brief Worker job of a step: write it on the bus thread and end a
+//  *        non-looping timer sweep after the last step
+//  * @param ctx - sweep
+//  * @return bus time of the step, see write_step
+
+int32_t AD910x_Sweep::run_step( void *ctx ) {
+    AD910x_Sweep *sweep = (AD910x_Sweep *)ctx;
+    int32_t us = sweep->write_step();
+    if ( sweep->pos == 0 && !sweep->repeat ) {
+        sweep->active.store( false );
+    }
+    return us;
+}
+
+//  * @brief Write the next step of the table and commit it with RAMUPDATE.
+//  *        DDS_TW32 and DDS_TW1 go out in one transaction when burst_en is
+//  *        set. The step after the last one is the first.
+//  * @param none
+//  * @return bus time of the step in microseconds (0 if the transport has no
+//  *         clock), -1 if the table is empty
+
+int32_t AD910x_Sweep::write_step() {
+    if ( num_steps == 0 ) {
+        return -1;
+    }
+    const AD910x_SweepStep &s = steps[pos];
+    uint8_t write = primed ? s.write : ( AD910X_SWEEP_TW | ( phase_mask ? AD910X_SWEEP_PW : 0 ) );
+    uint32_t frames = 2;
+    uint32_t t0 = dev.bus.time_us();
+
+    if ( write & AD910X_SWEEP_TW ) {
+        if ( dev.burst_en ) {
+            const uint16_t tw[2] = { s.tw32, s.tw1 };
+            dev.bus.select( mask );
+            dev.bus.write( AD910X_REG_DDS_TW32 );
+            dev.bus.write_block( tw, 2 );
+            dev.bus.deselect();
+            dev.bus.delay_us( 1 );
+            dev.shadow_reg( mask, AD910X_REG_DDS_TW32, s.tw32 );
+            dev.shadow_reg( mask, AD910X_REG_DDS_TW1, s.tw1 );
+            frames += 3;
+        } else {
+            dev.dev_write( mask, AD910X_REG_DDS_TW32, s.tw32 );
+            dev.dev_write( mask, AD910X_REG_DDS_TW1, s.tw1 );
+            frames += 4;
+        }
+    }
+    if ( write & AD910X_SWEEP_PW ) {
+        for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+            if ( phase_mask & ( 1 << ch ) ) {
+                dev.dev_write( mask, AD910X_REG_DDS_PW( ch ), s.pw );
+                frames += 2;
+            }
+        }
+    }
+    dev.dev_write( mask, AD910X_REG_RAMUPDATE, 0x0001 );
+
+    uint32_t us = dev.bus.time_us() - t0;
+    stats.steps++;
+    stats.frames_max = ( frames > stats.frames_max ) ? frames : stats.frames_max;
+    stats.bus_us_max = ( us > stats.bus_us_max ) ? us : stats.bus_us_max;
+    pos = ( pos + 1 == num_steps ) ? 0 : pos + 1;
+    primed = true;
+    return (int32_t)us;
+}
+
+//  * @brief Clear the cadence and bus statistics
+//  * @param none
+//  * @return none
+
+void AD910x_Sweep::reset_stats() {
+    memset( &stats, 0, sizeof( stats ) );
+}
+#pragma endregion
+
+#pragma region (TIMER)
+//  * @brief Step through the table at a fixed cadence. A sweep thread of
+//  *        realtime priority, woken by a Ticker on target, writes the steps;
+//  *        nothing else may use the driver until the sweep stops. With a
+//  *        worker the thread queues each step as a job instead, and a step
+//  *        the worker has not run by the next tick is skipped as an overrun.
+//  * @param period_us - step period in microseconds
+//  * @param loop - start over after the last step; false stops after it
+//  * @return 0, -1 if the table is empty, the timer is running or the period
+//  *         is shorter than the slowest step measured so far. Without a
+//  *         measured step the next step is written at once and timed, so
+//  *         max_rate_hz() holds before the timer starts.
+
+int AD910x_Sweep::start( uint32_t period_us, bool loop ) {
+    if ( num_steps == 0 || period_us == 0 || active.load() ) {
+        return -1;
+    }
+    if ( stats.bus_us_max == 0 ) {
+        if ( step() < 0 ) {
+            return -1;
+        }
+        if ( pos == 0 && !loop ) {
+            return 0;
+        }
+    }
+    if ( period_us < stats.bus_us_max ) {
+        return -1;
+    }
+    period = period_us;
+    repeat = loop;
+#if defined( __MBED__ )
+    if ( pending ) {
+        ended.acquire();
+    }
+    active.store( true );
+    pending = true;
+    if ( !launched ) {
+        launched = true;
+        thread.start( callback( this, &AD910x_Sweep::serve ) );
+    }
+    thread.flags_set( AD910X_SWEEP_GO );
+#else
+    active.store( true );
+    if ( thread.joinable() ) {
+        thread.join();
+    }
+    thread = std::thread( &AD910x_Sweep::run, this );
+#endif
+    return 0;
+}
+
+//  * @brief Stop the timer and wait for the step in progress
+//  * @param none
+//  * @return none
+
+void AD910x_Sweep::stop() {
+    active.store( false );
+#if defined( __MBED__ )
+    if ( pending ) {
+        thread.flags_set( AD910X_SWEEP_FLAG );
+        ended.acquire();
+        pending = false;
+    }
+#else
+    if ( thread.joinable() ) {
+        thread.join();
+    }
+#endif
+}
+
+//  * @brief Timer interrupt: wake the sweep thread
+//  * @param none
+//  * @return none
+
+void AD910x_Sweep::tick() {
+#if defined( __MBED__ )
+    thread.flags_set( AD910X_SWEEP_FLAG );
+#endif
+}
+
+#if defined( __MBED__ )
+//  * @brief Body of the sweep thread: wait for start() and run the table, so
+//  *        one thread serves every sweep of the object
+//  * @param none
+//  * @return none
+
+void AD910x_Sweep::serve() {
+    while ( true ) {
+        ThisThread::flags_wait_any( AD910X_SWEEP_GO );
+        run();
+        ended.release();
+    }
+}
+#endif
+
+//  * @brief Body of the sweep thread: write one step per period and measure
+//  *        how late each step starts and how far its interval is off
+//  * @param none
+//  * @return none
+
+void AD910x_Sweep::run() {
+    uint32_t deadline = now_us() + period;
+    uint32_t last = 0;
+    bool first = true;
+#if defined( __MBED__ )
+    ThisThread::flags_clear( AD910X_SWEEP_FLAG );
+    ticker.attach( callback( this, &AD910x_Sweep::tick ), std::chrono::microseconds( period ) );
+#else
+    std::chrono::steady_clock::time_point wake = std::chrono::steady_clock::now();
+#endif
+
+    while ( active.load() ) {
+#if defined( __MBED__ )
+        ThisThread::flags_wait_any( AD910X_SWEEP_FLAG );
+#else
+        wake += std::chrono::microseconds( period );
+        std::this_thread::sleep_until( wake );
+#endif
+        if ( !active.load() ) {
+            break;
+        }
+        uint32_t now = now_us();
+        int32_t late = (int32_t)( now - deadline );
+        if ( late > 0 ) {
+            stats.late_us_max = ( (uint32_t)late > stats.late_us_max ) ? (uint32_t)late : stats.late_us_max;
+            stats.overruns += ( (uint32_t)late >= period );
+        }
+        if ( !first ) {
+            int32_t off = (int32_t)( now - last - period );
+            uint32_t jitter = (uint32_t)( ( off < 0 ) ? -off : off );
+            stats.jitter_us_max = ( jitter > stats.jitter_us_max ) ? jitter : stats.jitter_us_max;
+            stats.jitter_us_total += jitter;
+        }
+        first = false;
+        last = now;
+        deadline += period;
+
+        if ( bus == NULL ) {
+            run_step( this );
+        } else if ( bus->submit( job ) != 0 ) {
+            stats.overruns++;
+        }
+    }
+    if ( bus != NULL && job.state.load() != AD910X_JOB_IDLE ) {
+        bus->wait( job );
+    }
+
+#if defined( __MBED__ )
+    ticker.detach();
+#endif
+}
+#pragma endregion
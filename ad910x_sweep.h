@@ -0,0 +1,141 @@
+/******************************************************************************
+    @file:  ad910x_sweep.h
+
+    @brief: Defines a DDS frequency and phase sweep engine that steps through
+            a precomputed table at a fixed cadence
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_sweep_h__
+#define __ad910x_sweep_h__
+#include <stdint.h>
+#include <atomic>
+#include "ad910x.h"
+#include "ad910x_worker.h"
+
+#if defined( __MBED__ )
+#include "mbed.h"
+#else
+#include <thread>
+#endif
+
+#define AD910X_SWEEP_STEPS      512             // Steps held by one sweep table
+#define AD910X_SWEEP_STACK      1024            // Stack bytes of the mbed sweep thread
+#define AD910X_SWEEP_FLAG       0x10000000      // Thread flag set by the sweep timer
+#define AD910X_SWEEP_GO         0x08000000      // Thread flag set by start() (mbed)
+
+/*** Registers a step writes (AD910x_SweepStep::write) ***/
+#define AD910X_SWEEP_TW         0x1             // DDS_TW32 and DDS_TW1
+#define AD910X_SWEEP_PW         0x2             // DDSx_PW of the phase channels
+
+/*** One step of a sweep table, in register format ***/
+struct AD910x_SweepStep {
+    uint16_t tw32;                              // DDS_TW32: tuning word bits 23:8
+    uint16_t tw1;                               // DDS_TW1: tuning word bits 7:0 in bits 15:8
+    uint16_t pw;                                // DDSx_PW of the phase channels
+    uint8_t write;                              // AD910X_SWEEP_* that differ from the step before
+};
+
+/*** Cadence and bus cost of the steps run since the last reset_stats() ***/
+struct AD910x_SweepStats {
+    uint32_t steps;                             // Steps written
+    uint32_t frames_max;                        // Most SPI frames of one step, commit included
+    uint32_t bus_us_max;                        // Longest step on the bus (see AD910x_Transport::time_us)
+    uint32_t late_us_max;                       // Latest step start after its deadline (timer only)
+    uint32_t jitter_us_max;                     // Largest deviation of a step interval from the period (timer only)
+    uint64_t jitter_us_total;
+    uint32_t overruns;                          // Steps started after the next deadline had passed, or skipped
+                                                // because the worker had not run the step before
+};
+
+/*** DDS sweep of the devices in one dev_mask of a driver ***/
+class AD910x_Sweep {
+    public:
+        // With a worker, steps run as jobs on its bus thread and the driver may be shared with other producers
+        AD910x_Sweep( AD910x_BASE &driver, uint32_t dev_mask, uint32_t dac_hz, AD910x_Worker *worker = NULL );
+        ~AD910x_Sweep();
+
+        // Fill the table with a linear chirp of n steps from f_start to f_stop (Hz); returns the steps or -1
+        int chirp( float f_start, float f_stop, uint16_t n );
+
+        // Fill the table with n frequencies (Hz) and phases (degrees, NULL for none) of the channels in phase_ch; returns n or -1
+        int table( const float freq_hz[], const float phase_deg[], uint16_t n, uint8_t phase_ch );
+
+        // Write the next step and commit it with RAMUPDATE; returns the bus time in microseconds or -1
+        int32_t step();
+
+        // Step through the table every period_us from a timer, after timing one step if none was measured; returns 0 or -1
+        int start( uint32_t period_us, bool loop );
+
+        // Stop the timer and wait for the step in progress
+        void stop();
+
+        // Check whether the timer is stepping
+        bool running() const { return active.load(); }
+
+        // Fastest step rate the bus sustained so far, 0 if no step was measured
+        uint32_t max_rate_hz() const { return ( stats.bus_us_max == 0 ) ? 0 : 1000000 / stats.bus_us_max; }
+
+        // Clear the cadence and bus statistics
+        void reset_stats();
+
+        // DDS tuning word of a frequency at a DAC clock
+        static uint32_t tuning_word( float hz, uint32_t dac_hz );
+
+        uint16_t num_steps;                     // Steps in the table
+        uint16_t pos;                           // Step written next
+        AD910x_SweepStats stats;
+        AD910x_SweepStep steps[AD910X_SWEEP_STEPS];
+
+    private:
+        // Mark the registers each step changes, the first step against the last one when looping
+        void mark_changes();
+
+        // Write the next step to the devices (bus thread when a worker is used)
+        int32_t write_step();
+
+        // Body of the worker job of a step
+        static int32_t run_step( void *ctx );
+
+        // Run the table until the sweep stops
+        void run();
+
+        // Body of the mbed sweep thread: one run() per start()
+        void serve();
+
+        // Timer interrupt: wake the sweep thread (mbed)
+        void tick();
+
+        AD910x_BASE &dev;
+        AD910x_Worker *bus;                     // Worker of the driver, NULL to call it directly
+        AD910x_Job job;                         // Worker job of the step in progress
+        uint32_t mask;
+        uint32_t dac_clk;
+        uint8_t phase_mask;                     // Channels whose DDSx_PW the table sets
+        bool primed;                            // The devices hold the step before pos
+        uint32_t period;                        // Timer period in microseconds
+        bool repeat;                            // Start over after the last step
+        std::atomic<bool> active;
+
+#if defined( __MBED__ )
+        Thread thread;                          // Sweep thread, started by the first start() and reused
+        Ticker ticker;                          // Cadence of the steps while a run is active
+        Semaphore ended;                        // Released when a run returns
+        bool launched;                          // thread is running serve()
+        bool pending;                           // A run was started and its end not yet collected
+#else
+        std::thread thread;
+#endif
+};
+#endif
@@ -0,0 +1,83 @@
+/******************************************************************************
+    @file:  ad910x_transport.h
+
+    @brief: Defines the SPI transport interface used by the AD910x driver, so
+            the same driver code runs on mbed SPI or on the host simulator
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_transport_h__
+#define __ad910x_transport_h__
+#include <stdint.h>
+
+/*** Events passed to AD910x_Callback ***/
+#define AD910X_EVENT_COMPLETE   0x1
+#define AD910X_EVENT_ERROR      0x2
+
+#define AD910X_MAX_DEVS         32      // Devices addressable by a dev_mask
+
+// Completion callback of asynchronous transfers; may run in interrupt context
+typedef void (*AD910x_Callback)( void *ctx, int event );
+
+class AD910x_Transport {
+    public:
+        virtual ~AD910x_Transport() {}
+
+        // Function to set SPI word length and mode
+        virtual void format( uint8_t reg_len, uint8_t mode ) = 0;
+
+        // Function to set SPI bus frequency
+        virtual void frequency( uint32_t hz ) = 0;
+
+        // SPI clock in effect after prescaler selection, 0 if the transport cannot tell
+        virtual uint32_t get_frequency() { return 0; }
+
+        // Assert chip select of every device in dev_mask (bit n = device n)
+        virtual void select( uint32_t dev_mask ) = 0;
+
+        // Release all chip selects
+        virtual void deselect() = 0;
+
+        // Shift one frame out and return the frame shifted in
+        virtual uint16_t write( uint16_t frame ) = 0;
+
+        // Shift n frames out back-to-back, discarding the frames shifted in
+        virtual void write_block( const uint16_t frames[], uint32_t n ) {
+            for ( uint32_t i=0; i<n; i++ ) {
+                write( frames[i] );
+            }
+        }
+
+        // Start shifting n frames out in the background and call cb when done.
+        // Returns 0 if the transfer was started. Transports without DMA send
+        // the block before returning.
+        virtual int write_block_async( const uint16_t frames[], uint32_t n, AD910x_Callback cb, void *ctx ) {
+            write_block( frames, n );
+            cb( ctx, AD910X_EVENT_COMPLETE );
+            return 0;
+        }
+
+        // Busy-wait for a number of microseconds
+        virtual void delay_us( uint32_t us ) = 0;
+
+        // Free-running microsecond clock for latency measurements, 0 if the transport cannot tell
+        virtual uint32_t time_us() { return 0; }
+
+        // Drive AD910x reset pin
+        virtual void set_reset( int level ) = 0;
+
+        // Drive AD910x trigger pin
+        virtual void set_trigger( int level ) = 0;
+};
+#endif
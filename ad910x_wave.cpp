@@ -0,0 +1,152 @@
+/******************************************************************************
+    @file:  ad910x_wave.cpp
+
+    @brief: Implements the packed waveform encoder and streaming decoder
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include "ad910x_wave.h"
+
+#pragma region (ENCODER)
+//  * @brief Pack samples as run, delta and absolute tokens (see ad910x_wave.h).
+//  *        A run token is used wherever it is shorter than the single tokens
+//  *        it replaces.
+//  * @param data[] - samples
+//  * @param n - number of samples
+//  * @param out[] - packed data
+//  * @param max - size of out[] in bytes
+//  * @return packed size in bytes, 0 on error
+
+uint32_t AD910x_pack_wave( const int16_t data[], uint16_t n, uint8_t out[], uint32_t max ) {
+    uint32_t len = 0;
+    int16_t prev = 0;
+    uint16_t i = 0;
+
+    while ( i < n ) {
+        if ( data[i] < AD910X_WAVE_MIN || data[i] > AD910X_WAVE_MAX ) {
+            return 0;
+        }
+        int delta = data[i] - prev;
+
+        // * Count samples continuing with the same delta * //
+        uint16_t run = 0;
+        if ( delta >= -128 && delta <= 127 ) {
+            int16_t x = prev;
+            while ( i + run < n && run < AD910X_WAVE_RUN_MAX && data[i + run] - x == delta ) {
+                x = data[i + run];
+                run++;
+            }
+        }
+
+        bool small = delta >= -64 && delta <= 63;
+        if ( run >= 4 || ( !small && run >= 2 ) ) {
+            if ( len + 3 > max ) {
+                return 0;
+            }
+            out[len++] = AD910X_WAVE_RUN | ( ( run - 1 ) >> 8 );
+            out[len++] = ( run - 1 ) & 0xFF;
+            out[len++] = (uint8_t)(int8_t)delta;
+            prev = data[i + run - 1];
+            i += run;
+        } else if ( small ) {
+            if ( len + 1 > max ) {
+                return 0;
+            }
+            out[len++] = delta & 0x7F;
+            prev = data[i++];
+        } else {
+            if ( len + 2 > max ) {
+                return 0;
+            }
+            out[len++] = AD910X_WAVE_ABS | ( ( data[i] >> 8 ) & 0x3F );
+            out[len++] = data[i] & 0xFF;
+            prev = data[i++];
+        }
+    }
+    return len;
+}
+#pragma endregion
+
+#pragma region (DECODER)
+AD910x_WaveDecoder::AD910x_WaveDecoder( const AD910x_PackedWave &wave ) : pos( wave.data ), end( wave.data + wave.size ),
+        left( wave.samples ), run( 0 ), run_delta( 0 ), prev( 0 ), corrupt( false ) {
+}
+
+//  * @brief Decode the next samples of the waveform
+//  * @param out[] - decoded samples
+//  * @param max - number of samples requested
+//  * @return number of samples decoded; less than max at the end of the waveform or on error
+
+uint16_t AD910x_WaveDecoder::read( int16_t out[], uint16_t max ) {
+    uint16_t n = 0;
+
+    if ( max > left ) {
+        max = left;
+    }
+
+    while ( n < max ) {
+        // * Continue a run token * //
+        if ( run != 0 ) {
+            uint16_t k = ( run < max - n ) ? run : max - n;
+            int16_t x = prev;
+            for ( uint16_t j=0; j<k; j++ ) {
+                x += run_delta;
+                out[n++] = x;
+            }
+            prev = x;
+            run -= k;
+            continue;
+        }
+
+        if ( pos == end ) {
+            corrupt = true;
+            break;
+        }
+        uint8_t tok = *pos++;
+
+        if ( tok < AD910X_WAVE_RUN ) {
+            prev += (int8_t)( tok << 1 ) >> 1;
+            out[n++] = prev;
+        } else if ( tok < AD910X_WAVE_ABS ) {
+            if ( end - pos < 2 ) {
+                corrupt = true;
+                break;
+            }
+            run = ( ( ( tok & 0x3F ) << 8 ) | pos[0] ) + 1;
+            run_delta = (int8_t)pos[1];
+            pos += 2;
+        } else {
+            if ( pos == end ) {
+                corrupt = true;
+                break;
+            }
+            int16_t x = ( ( tok & 0x3F ) << 8 ) | *pos++;
+            prev = ( x ^ 0x2000 ) - 0x2000;
+            out[n++] = prev;
+        }
+    }
+
+    left -= n;
+    return n;
+}
+
+//  * @brief Sample source adapter for AD910x_BASE::dev_stream_sram
+//  * @param ctx - AD910x_WaveDecoder
+//  * @param out[] - decoded samples
+//  * @param max - number of samples requested
+//  * @return number of samples decoded
+
+uint16_t AD910x_WaveDecoder::source( void *ctx, int16_t out[], uint16_t max ) {
+    return ( (AD910x_WaveDecoder *)ctx )->read( out, max );
+}
+#pragma endregion
@@ -0,0 +1,68 @@
+/******************************************************************************
+    @file:  ad910x_wave.h
+
+    @brief: Defines the packed waveform format of AD910x SRAM patterns, its
+            encoder and the streaming decoder used during SRAM upload
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_wave_h__
+#define __ad910x_wave_h__
+#include <stdint.h>
+
+/*** Packed waveform tokens. Each token produces samples relative to the
+     previous sample, which starts at 0:
+       0x00-0x7F            1 byte   previous + 7-bit signed delta
+       0x80-0xBF n d        3 byte   ((tok & 0x3F) << 8 | n) + 1 samples, each previous + int8 delta d
+       0xC0-0xFF v          2 byte   14-bit signed sample ((tok & 0x3F) << 8 | v) ***/
+#define AD910X_WAVE_RUN         0x80
+#define AD910X_WAVE_ABS         0xC0
+#define AD910X_WAVE_RUN_MAX     0x4000          // Samples per run token
+#define AD910X_WAVE_MIN         -8192           // Sample range of absolute tokens
+#define AD910X_WAVE_MAX         8191
+
+/*** Waveform stored in packed form ***/
+struct AD910x_PackedWave {
+    uint16_t samples;           // Number of decoded samples
+    uint16_t size;              // Bytes of data
+    const uint8_t *data;
+};
+
+// Pack n samples into out[] (max bytes); returns the packed size, or 0 if out[] is too small or a sample is out of range
+uint32_t AD910x_pack_wave( const int16_t data[], uint16_t n, uint8_t out[], uint32_t max );
+
+/*** Streaming decoder of a packed waveform ***/
+class AD910x_WaveDecoder {
+    public:
+        AD910x_WaveDecoder( const AD910x_PackedWave &wave );
+
+        // Decode up to max samples into out[]; returns the number of samples decoded
+        uint16_t read( int16_t out[], uint16_t max );
+
+        // True if the data ended before all samples were decoded
+        bool error() const { return corrupt; }
+
+        // AD910x_SampleSource adapter, ctx is the decoder
+        static uint16_t source( void *ctx, int16_t out[], uint16_t max );
+
+    private:
+        const uint8_t *pos;
+        const uint8_t *end;
+        uint16_t left;              // Samples still to be decoded
+        uint16_t run;               // Samples left of the current run token
+        int8_t run_delta;
+        int16_t prev;
+        bool corrupt;
+};
+#endif
@@ -0,0 +1,140 @@
+/******************************************************************************
+    @file:  ad910x_wire.cpp
+
+    @brief: Implements batch conversion of waveform samples to AD910x SRAM
+            wire format. Uses the Cortex-M DSP extension on target, SSE2 on
+            x86 hosts and a plain loop elsewhere.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "ad910x_wire.h"
+
+#if defined( __ARM_FEATURE_DSP )
+#include "cmsis.h"
+#elif defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
+#pragma region (SCALAR)
+//  * @brief Saturate one sample and shift it to wire format
+//  * @param x - sample
+//  * @return SRAM word
+
+static inline uint16_t wire( int32_t x ) {
+    x = ( x < AD910X_SAMPLE_MIN ) ? AD910X_SAMPLE_MIN : x;
+    x = ( x > AD910X_SAMPLE_MAX ) ? AD910X_SAMPLE_MAX : x;
+    return (uint16_t)( (uint32_t)x << 2 );
+}
+
+//  * @brief Scale one normalized sample, saturate it and round to nearest
+//  * @param x - sample, -1.0 .. 1.0
+//  * @return 14-bit sample
+
+static inline int32_t scale( float x ) {
+    x *= -AD910X_SAMPLE_MIN;
+    x = ( x < AD910X_SAMPLE_MIN ) ? AD910X_SAMPLE_MIN : x;
+    x = ( x > AD910X_SAMPLE_MAX ) ? AD910X_SAMPLE_MAX : x;
+    return (int32_t)lrintf( x );
+}
+#pragma endregion
+
+#pragma region (CONVERSION)
+//  * @brief Saturate 16-bit samples to 14 bits and shift them to wire format
+//  * @param out[] - n SRAM words, may be the same memory as in[]
+//  * @param in[] - n samples
+//  * @param n - number of samples
+//  * @return none
+
+void AD910x_to_wire( uint16_t out[], const int16_t in[], uint32_t n ) {
+    uint32_t i = 0;
+
+#if defined( __ARM_FEATURE_DSP )
+    // * Two samples per word: saturate both halves, shift and drop the bits crossing into the upper half * //
+    for ( ; i + 2 <= n; i += 2 ) {
+        uint32_t x;
+        memcpy( &x, &in[i], 4 );
+        x = ( (uint32_t)__SSAT16( (int32_t)x, 14 ) << 2 ) & 0xFFFCFFFC;
+        memcpy( &out[i], &x, 4 );
+    }
+#elif defined( __SSE2__ )
+    const __m128i lo = _mm_set1_epi16( AD910X_SAMPLE_MIN );
+    const __m128i hi = _mm_set1_epi16( AD910X_SAMPLE_MAX );
+    for ( ; i + 8 <= n; i += 8 ) {
+        __m128i x = _mm_loadu_si128( (const __m128i *)&in[i] );
+        x = _mm_min_epi16( _mm_max_epi16( x, lo ), hi );
+        _mm_storeu_si128( (__m128i *)&out[i], _mm_slli_epi16( x, 2 ) );
+    }
+#endif
+
+    for ( ; i < n; i++ ) {
+        out[i] = wire( in[i] );
+    }
+}
+
+//  * @brief Saturate 32-bit samples to 14 bits and shift them to wire format
+//  * @param out[] - n SRAM words
+//  * @param in[] - n samples
+//  * @param n - number of samples
+//  * @return none
+
+void AD910x_to_wire( uint16_t out[], const int32_t in[], uint32_t n ) {
+    uint32_t i = 0;
+
+#if defined( __ARM_FEATURE_DSP )
+    for ( ; i < n; i++ ) {
+        out[i] = (uint16_t)( (uint32_t)__SSAT( in[i], 14 ) << 2 );
+    }
+#elif defined( __SSE2__ )
+    const __m128i lo = _mm_set1_epi16( AD910X_SAMPLE_MIN );
+    const __m128i hi = _mm_set1_epi16( AD910X_SAMPLE_MAX );
+    for ( ; i + 8 <= n; i += 8 ) {
+        __m128i x = _mm_packs_epi32( _mm_loadu_si128( (const __m128i *)&in[i] ), _mm_loadu_si128( (const __m128i *)&in[i + 4] ) );
+        x = _mm_min_epi16( _mm_max_epi16( x, lo ), hi );
+        _mm_storeu_si128( (__m128i *)&out[i], _mm_slli_epi16( x, 2 ) );
+    }
+#endif
+
+    for ( ; i < n; i++ ) {
+        out[i] = wire( in[i] );
+    }
+}
+
+//  * @brief Scale normalized samples to 14 bits, round, saturate and shift them to wire format
+//  * @param out[] - n SRAM words
+//  * @param in[] - n samples; -1.0 .. 1.0 maps to -8192 .. 8191
+//  * @param n - number of samples
+//  * @return none
+
+void AD910x_to_wire( uint16_t out[], const float in[], uint32_t n ) {
+    uint32_t i = 0;
+
+#if defined( __SSE2__ ) && !defined( __ARM_FEATURE_DSP )
+    const __m128 gain = _mm_set1_ps( -AD910X_SAMPLE_MIN );
+    const __m128 lo = _mm_set1_ps( AD910X_SAMPLE_MIN );
+    const __m128 hi = _mm_set1_ps( AD910X_SAMPLE_MAX );
+    for ( ; i + 8 <= n; i += 8 ) {
+        __m128 a = _mm_min_ps( _mm_max_ps( _mm_mul_ps( _mm_loadu_ps( &in[i] ), gain ), lo ), hi );
+        __m128 b = _mm_min_ps( _mm_max_ps( _mm_mul_ps( _mm_loadu_ps( &in[i + 4] ), gain ), lo ), hi );
+        __m128i x = _mm_packs_epi32( _mm_cvtps_epi32( a ), _mm_cvtps_epi32( b ) );
+        _mm_storeu_si128( (__m128i *)&out[i], _mm_slli_epi16( x, 2 ) );
+    }
+#endif
+
+    // * Cortex-M7 converts in its FPU, one sample at a time * //
+    for ( ; i < n; i++ ) {
+        out[i] = wire( scale( in[i] ) );
+    }
+}
+#pragma endregion
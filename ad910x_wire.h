@@ -0,0 +1,36 @@
+/******************************************************************************
+    @file:  ad910x_wire.h
+
+    @brief: Defines batch conversion of waveform samples to AD910x SRAM
+            wire format
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_wire_h__
+#define __ad910x_wire_h__
+#include <stdint.h>
+
+/*** Range of the 14-bit sample field in bits 15:2 of an SRAM word ***/
+#define AD910X_SAMPLE_MIN       -8192
+#define AD910X_SAMPLE_MAX       8191
+
+// Saturate n samples and shift them to wire format
+void AD910x_to_wire( uint16_t out[], const int16_t in[], uint32_t n );
+
+// Same for 32-bit samples
+void AD910x_to_wire( uint16_t out[], const int32_t in[], uint32_t n );
+
+// Same for normalized samples: -1.0 .. 1.0 maps to full scale
+void AD910x_to_wire( uint16_t out[], const float in[], uint32_t n );
+#endif
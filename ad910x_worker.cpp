@@ -0,0 +1,325 @@
+/******************************************************************************
+    @file:  ad910x_worker.cpp
+
+    @brief: Implements a bus-owner thread fed by a bounded lock-free queue of
+            jobs. Producers only touch the queue; the bus thread is the only
+            user of the driver. Uses an mbed thread on target and std::thread
+            on the host.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include "ad910x_worker.h"
+
+#if defined( __MBED__ )
+#include "mbed.h"
+#else
+#include <chrono>
+#endif
+
+// Marks AD910x_Job::waiter once the bus thread has taken it (mbed)
+#define JOB_CLAIMED     ( (void *)-1 )
+
+//  * @brief Read the microsecond clock of the latency metrics
+//  * @param none
+//  * @return time in microseconds, wrapping
+
+static uint32_t now_us() {
+#if defined( __MBED__ )
+    return us_ticker_read();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+}
+
+//  * @param driver - driver of the bus; owned by the bus thread while it runs
+
+AD910x_Worker::AD910x_Worker( AD910x_BASE &driver ) :
+        submitted( 0 ), rejected( 0 ), stats(), dev( driver ), enq_pos( 0 ), deq_pos( 0 ), running( false ) {
+    for ( uint32_t i=0; i<AD910X_QUEUE_DEPTH; i++ ) {
+        ring[i].seq.store( i );
+        ring[i].job = NULL;
+    }
+#if defined( __MBED__ )
+    thread = NULL;
+#endif
+}
+
+AD910x_Worker::~AD910x_Worker() {
+    stop();
+}
+
+#pragma region (THREAD)
+//  * @brief Start the bus thread
+//  * @param none
+//  * @return none
+
+void AD910x_Worker::start() {
+    if ( running.exchange( true ) ) {
+        return;
+    }
+#if defined( __MBED__ )
+    Thread *t = new Thread( osPriorityAboveNormal, AD910X_BUS_STACK );
+    thread = t;
+    t->start( callback( this, &AD910x_Worker::run ) );
+#else
+    thread = std::thread( &AD910x_Worker::run, this );
+#endif
+}
+
+//  * @brief End the bus thread after it has run the queued jobs. Producers
+//  *        must have stopped submitting.
+//  * @param none
+//  * @return none
+
+void AD910x_Worker::stop() {
+    if ( !running.exchange( false ) ) {
+        return;
+    }
+    wake();
+#if defined( __MBED__ )
+    Thread *t = (Thread *)thread;
+    t->join();
+    delete t;
+    thread = NULL;
+#else
+    thread.join();
+#endif
+}
+
+//  * @brief Run jobs in submission order and sleep while the queue is empty
+//  * @param none
+//  * @return none
+
+void AD910x_Worker::run() {
+    while ( true ) {
+        AD910x_Job *job = pop();
+        if ( job == NULL ) {
+            if ( !running.load() && depth() == 0 ) {
+#if defined( __MBED__ )
+                stats.stack_max = ( (Thread *)thread )->max_stack();
+#endif
+                return;
+            }
+#if defined( __MBED__ )
+            ThisThread::flags_wait_any( AD910X_JOB_FLAG );
+#else
+            std::unique_lock<std::mutex> lock( sleep_lock );
+            bus_cv.wait( lock, [this] { return depth() != 0 || !running.load(); } );
+#endif
+            continue;
+        }
+
+        uint32_t queued = depth() + 1;
+        stats.depth_max = ( queued > stats.depth_max ) ? queued : stats.depth_max;
+        uint32_t start = now_us();
+        uint32_t wait_us = start - job->queued_us;
+        job->state.store( AD910X_JOB_RUNNING );
+        job->result = execute( *job );
+        uint32_t run_us = now_us() - start;
+
+        stats.completed++;
+        stats.wait_us_max = ( wait_us > stats.wait_us_max ) ? wait_us : stats.wait_us_max;
+        stats.wait_us_total += wait_us;
+        stats.run_us_max = ( run_us > stats.run_us_max ) ? run_us : stats.run_us_max;
+        stats.run_us_total += run_us;
+
+        if ( job->done != NULL ) {
+            job->done( job->ctx, *job );
+        }
+        finish( *job );
+    }
+}
+
+//  * @brief Wake the bus thread
+//  * @param none
+//  * @return none
+
+void AD910x_Worker::wake() {
+#if defined( __MBED__ )
+    if ( thread != NULL ) {
+        ( (Thread *)thread )->flags_set( AD910X_JOB_FLAG );
+    }
+#else
+    {
+        std::lock_guard<std::mutex> lock( sleep_lock );
+    }
+    bus_cv.notify_one();
+#endif
+}
+
+//  * @brief Mark a job done and wake its waiter. The job is not touched after
+//  *        the state changes, since the producer may reuse it at once.
+//  * @param job - finished job
+//  * @return none
+
+void AD910x_Worker::finish( AD910x_Job &job ) {
+#if defined( __MBED__ )
+    void *waiter = job.waiter.exchange( JOB_CLAIMED );
+    job.state.store( AD910X_JOB_DONE );
+    if ( waiter != NULL ) {
+        osThreadFlagsSet( (osThreadId_t)waiter, AD910X_JOB_FLAG );
+    }
+#else
+    {
+        std::lock_guard<std::mutex> lock( sleep_lock );
+        job.state.store( AD910X_JOB_DONE );
+    }
+    done_cv.notify_all();
+#endif
+}
+#pragma endregion
+
+#pragma region (QUEUE)
+//  * @brief Queue a job. Lock-free, so it may be called from any thread and,
+//  *        on target, from interrupt context.
+//  * @param job - job to run; it and its buffers must stay valid until it is done
+//  * @return 0 if queued, -1 if the queue is full, the job is already queued or
+//  *         running, or the bus thread is not running
+
+int AD910x_Worker::submit( AD910x_Job &job ) {
+    if ( !running.load() ) {
+        return -1;
+    }
+    // * Claim the job in one step, so two producers cannot both queue it * //
+    uint8_t state = AD910X_JOB_IDLE;
+    if ( !job.state.compare_exchange_strong( state, AD910X_JOB_QUEUED ) ) {
+        state = AD910X_JOB_DONE;
+        if ( !job.state.compare_exchange_strong( state, AD910X_JOB_QUEUED ) ) {
+            return -1;
+        }
+    }
+    job.waiter.store( NULL );
+    job.queued_us = now_us();
+
+    // * Claim a cell: its seq equals the position when it is free for this lap * //
+    uint32_t pos = enq_pos.load( std::memory_order_relaxed );
+    Cell *cell;
+    while ( true ) {
+        cell = &ring[pos % AD910X_QUEUE_DEPTH];
+        int32_t lap = (int32_t)( cell->seq.load( std::memory_order_acquire ) - pos );
+        if ( lap == 0 ) {
+            if ( enq_pos.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) ) {
+                break;
+            }
+        } else if ( lap < 0 ) {
+            job.state.store( state );
+            rejected++;
+            return -1;
+        } else {
+            pos = enq_pos.load( std::memory_order_relaxed );
+        }
+    }
+    cell->job = &job;
+    cell->seq.store( pos + 1, std::memory_order_release );
+
+    submitted++;
+    wake();
+    return 0;
+}
+
+//  * @brief Take the oldest published job (bus thread only)
+//  * @param none
+//  * @return job, NULL if the queue is empty or the next cell is not yet published
+
+AD910x_Job *AD910x_Worker::pop() {
+    uint32_t pos = deq_pos.load( std::memory_order_relaxed );
+    Cell &cell = ring[pos % AD910X_QUEUE_DEPTH];
+    if ( cell.seq.load( std::memory_order_acquire ) != pos + 1 ) {
+        return NULL;
+    }
+    AD910x_Job *job = cell.job;
+    cell.seq.store( pos + AD910X_QUEUE_DEPTH, std::memory_order_release );
+    deq_pos.store( pos + 1, std::memory_order_release );
+    return job;
+}
+
+//  * @brief Block the calling thread until a job is done
+//  * @param job - submitted job
+//  * @return result of the job, -1 if it was never submitted
+
+int32_t AD910x_Worker::wait( AD910x_Job &job ) {
+    if ( job.state.load() == AD910X_JOB_IDLE ) {
+        return -1;
+    }
+#if defined( __MBED__ )
+    void *none = NULL;
+    if ( job.waiter.compare_exchange_strong( none, (void *)ThisThread::get_id() ) ) {
+        while ( job.state.load() != AD910X_JOB_DONE ) {
+            ThisThread::flags_wait_any( AD910X_JOB_FLAG );
+        }
+    } else {
+        // * The bus thread has claimed the job and is about to mark it done * //
+        while ( job.state.load() != AD910X_JOB_DONE ) {
+            ThisThread::yield();
+        }
+    }
+#else
+    std::unique_lock<std::mutex> lock( sleep_lock );
+    done_cv.wait( lock, [&job] { return job.state.load() == AD910X_JOB_DONE; } );
+#endif
+    return job.result;
+}
+#pragma endregion
+
+#pragma region (JOBS)
+//  * @brief Run one job with the driver primitives
+//  * @param job - job to run
+//  * @return frames saved (REGS), 0 (SRAM, TRIGGER), words read (READ), the
+//  *         result of call (CALL), -1 on a bad job or an SRAM write the
+//  *         driver refused
+
+int32_t AD910x_Worker::execute( AD910x_Job &job ) {
+    switch ( job.type ) {
+        case AD910X_JOB_REGS:
+            for ( int i=0; i<job.n; i++ ) {
+                if ( job.addr[i] >= AD910X_REG_SPACE ) {
+                    return -1;
+                }
+            }
+            return (int32_t)dev.dev_write_regs( job.dev_mask, job.addr, (const uint16_t *)job.data, job.n );
+
+        case AD910X_JOB_SRAM:
+            return dev.dev_update_sram_range( job.dev_mask, job.offset, job.n, (const int16_t *)job.data );
+
+        case AD910X_JOB_TRIGGER:
+            if ( job.offset == 0 ) {
+                dev.AD910x_start_pattern();
+            } else {
+                dev.AD910x_stop_pattern();
+            }
+            return 0;
+
+        case AD910X_JOB_READ: {
+            uint32_t all = ( dev.num_devs >= 32 ) ? 0xFFFFFFFF : ( 1u << dev.num_devs ) - 1;
+            bool sram = ( job.offset >= AD910X_SRAM_ADDR );
+            uint32_t end = (uint32_t)job.offset + job.n;
+            if ( job.out == NULL || ( job.dev_mask & all ) == 0 || end > ( sram ? AD910X_SRAM_ADDR + AD910X_SRAM_SIZE : AD910X_REG_SPACE ) ) {
+                return -1;
+            }
+            uint32_t one = 1u << dev.first_dev( job.dev_mask & all );
+            if ( sram ) {
+                dev.dev_read_sram( one, job.offset - AD910X_SRAM_ADDR, job.out, job.n );
+            } else {
+                dev.dev_read_block( one, job.offset, job.out, job.n );
+            }
+            return job.n;
+        }
+
+        case AD910X_JOB_CALL:
+            return ( job.call != NULL ) ? job.call( job.ctx ) : -1;
+
+        default:
+            return -1;
+    }
+}
+#pragma endregion
@@ -0,0 +1,163 @@
+/******************************************************************************
+    @file:  ad910x_worker.h
+
+    @brief: Defines a bus-owner thread that runs queued AD910x jobs, so that
+            several producers can use the devices without sharing the driver
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_worker_h__
+#define __ad910x_worker_h__
+#include <stdint.h>
+#include <atomic>
+#include "ad910x.h"
+
+#if !defined( __MBED__ )
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#define AD910X_QUEUE_DEPTH      32              // Jobs held by the queue (power of two)
+/*** Stack bytes of the mbed bus thread. The deepest job path is a register
+     batch (dev_write_regs: about 600 bytes of planning tables) or an SRAM
+     range with verify_mode other than AD910X_VERIFY_NONE (64-word stream
+     and readback buffers), plus printf when log_level is AD910X_LOG_SUMMARY
+     or AD910X_LOG_FULL; AD910X_LOG_DEFERRED only queues records. Check
+     stats.stack_max after a verified upload with AD910X_LOG_FULL before
+     lowering it. ***/
+#define AD910X_BUS_STACK        4096
+#define AD910X_JOB_FLAG         0x20000000      // Thread flag of the bus thread and of threads in AD910x_Worker::wait
+
+/*** Job types ***/
+#define AD910X_JOB_REGS         1               // Write n registers addr[i] = data[i] in as few transactions as possible
+#define AD910X_JOB_SRAM         2               // Write n samples data[] to SRAM, starting at word offset
+#define AD910X_JOB_TRIGGER      3               // Start (offset 0) or stop (offset 1) pattern generation
+#define AD910X_JOB_READ         4               // Read n words from SPI/SRAM address offset of the lowest device into out[]
+#define AD910X_JOB_CALL         5               // Run call( ctx ) on the bus thread: driver calls that must not interleave with other jobs
+
+/*** Job states ***/
+#define AD910X_JOB_IDLE         0
+#define AD910X_JOB_QUEUED       1
+#define AD910X_JOB_RUNNING      2
+#define AD910X_JOB_DONE         3
+
+struct AD910x_Job;
+
+// Completion callback, run on the bus thread before the job becomes AD910X_JOB_DONE
+typedef void (*AD910x_JobDone)( void *ctx, AD910x_Job &job );
+
+// Body of an AD910X_JOB_CALL job, run on the bus thread; its return value is the job result
+typedef int32_t (*AD910x_JobCall)( void *ctx );
+
+/*** One unit of bus work. The producer owns the job and its buffers until it is done. ***/
+struct AD910x_Job {
+    uint8_t type = 0;                           // AD910X_JOB_*
+    uint32_t dev_mask = 0;                      // Devices of the job
+    uint16_t offset = 0;                        // SRAM word, SPI/SRAM address or trigger level, see AD910X_JOB_*
+    uint16_t n = 0;                             // Registers, samples or words
+    const uint16_t *addr = NULL;                // REGS: register addresses
+    const void *data = NULL;                    // REGS: uint16_t values; SRAM: int16_t samples
+    uint16_t *out = NULL;                       // READ: output words (SRAM in wire format)
+    AD910x_JobCall call = NULL;                 // CALL: function run on the bus thread
+    AD910x_JobDone done = NULL;                 // Optional completion callback
+    void *ctx = NULL;                           // Argument of call and done
+
+    int32_t result = 0;                         // Return value of the driver call, -1 on error
+    uint32_t queued_us = 0;                     // Worker clock at submission, for the latency metrics
+    std::atomic<uint8_t> state{ AD910X_JOB_IDLE };
+    std::atomic<void *> waiter{ nullptr };      // Thread blocked in AD910x_Worker::wait
+};
+
+/*** Queue and latency metrics ***/
+struct AD910x_WorkerStats {
+    uint32_t completed;                         // Jobs run
+    uint32_t depth_max;                         // Most jobs queued when the bus thread took one
+    uint32_t wait_us_max;                       // Longest time from submission to start
+    uint64_t wait_us_total;
+    uint32_t run_us_max;                        // Longest time from start to completion
+    uint64_t run_us_total;
+    uint32_t stack_max;                         // Stack high-water mark of the bus thread in bytes, set when it ends (mbed)
+};
+
+/*** Owner of one driver's bus: producers submit jobs from any thread or
+     interrupt, the bus thread runs them in submission order ***/
+class AD910x_Worker {
+    public:
+        AD910x_Worker( AD910x_BASE &driver );
+        ~AD910x_Worker();
+
+        // Start the bus thread; the driver must not be used directly until stop()
+        void start();
+
+        // Run the jobs still queued and end the bus thread
+        void stop();
+
+        // Queue a job; returns 0, or -1 if the queue is full, the job is in use or the thread is not running
+        int submit( AD910x_Job &job );
+
+        // Block until a submitted job is done and return its result
+        int32_t wait( AD910x_Job &job );
+
+        // Check whether a job is done, without blocking
+        static bool ready( const AD910x_Job &job ) { return job.state.load() == AD910X_JOB_DONE; }
+
+        // Jobs queued and not yet started
+        uint32_t depth() const { return enq_pos.load() - deq_pos.load(); }
+
+        // Check whether the bus thread is running
+        bool started() const { return running.load(); }
+
+        std::atomic<uint32_t> submitted;        // Jobs accepted by submit
+        std::atomic<uint32_t> rejected;         // Jobs refused because the queue was full
+        AD910x_WorkerStats stats;               // Written by the bus thread
+
+    private:
+        /*** Cell of the bounded multi-producer queue: seq tells producers and the consumer whose turn it is ***/
+        struct Cell {
+            std::atomic<uint32_t> seq;
+            AD910x_Job *job;
+        };
+
+        // Body of the bus thread
+        void run();
+
+        // Take the oldest job; returns NULL if the queue is empty
+        AD910x_Job *pop();
+
+        // Run one job with the driver
+        int32_t execute( AD910x_Job &job );
+
+        // Wake the bus thread after a submission or stop
+        void wake();
+
+        // Signal the thread waiting for a job
+        void finish( AD910x_Job &job );
+
+        AD910x_BASE &dev;
+        Cell ring[AD910X_QUEUE_DEPTH];
+        std::atomic<uint32_t> enq_pos;          // Next cell of a producer
+        std::atomic<uint32_t> deq_pos;          // Next cell of the bus thread
+        std::atomic<bool> running;
+
+#if defined( __MBED__ )
+        void *thread;                           // rtos::Thread of the bus
+#else
+        std::thread thread;
+        std::mutex sleep_lock;                  // Protects nothing but the sleeps of the bus thread and of waiters
+        std::condition_variable bus_cv;
+        std::condition_variable done_cv;
+#endif
+};
+#endif
@@ -0,0 +1,1222 @@
+/******************************************************************************
+    @file:  ad910x_bench.cpp
+ 
+    @brief: Measures SPI traffic and modeled bus time of the AD910x driver
+            on the host simulator
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <thread>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include "config.h"
+#include "ad910x.h"
+#include "ad910x_cmdserver.h"
+#include "ad910x_host.h"
+#include "ad910x_parallel.h"
+#include "ad910x_preset.h"
+#include "ad910x_sim.h"
+#include "ad910x_sweep.h"
+#include "ad910x_worker.h"
+
+//  * @brief Print statistics of the last measured operation and clear them
+//  * @param sim - simulator
+//  * @param name - operation name
+//  * @return none
+
+static AD910x_Stats *dev_stats;
+
+static void report( AD910x_SIM &sim, const char *name ) {
+    fprintf( stderr, "%-28s frames %6llu  cs %5llu  sram %4u/%4u regs %2u/%2u skipped %3u saved  errors %llu  time %8.3f ms\n", name,
+            (unsigned long long)sim.stats.frames, (unsigned long long)sim.stats.cs_toggles,
+            dev_stats->sram_skipped, dev_stats->sram_skipped + dev_stats->sram_written,
+            dev_stats->reg_skipped, dev_stats->reg_skipped + dev_stats->reg_written, dev_stats->reg_frames_saved,
+            (unsigned long long)sim.stats.access_errors, sim.time_ns() / 1e6 );
+    sim.reset_stats();
+    memset( dev_stats, 0, sizeof( *dev_stats ) );
+}
+
+/*** Memory sink of binary dumps ***/
+struct DumpBuffer {
+    uint8_t data[80000];
+    uint32_t len;
+};
+
+static int dump_to_buffer( void *ctx, const uint8_t data[], uint32_t n ) {
+    DumpBuffer *buf = (DumpBuffer *)ctx;
+    if ( buf->len + n > sizeof( buf->data ) ) {
+        return -1;
+    }
+    memcpy( buf->data + buf->len, data, n );
+    buf->len += n;
+    return 0;
+}
+
+/*** Command server of a simulated board, reading one side of a PTY until it is closed ***/
+static int pty_write( void *ctx, const uint8_t data[], uint32_t n ) {
+    return ( write( *(int *)ctx, data, n ) == (ssize_t)n ) ? 0 : -1;
+}
+
+static void serve_pty( AD910x_CmdServer *server, int fd ) {
+    uint8_t buf[4096];
+    ssize_t got = 1;
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    while ( got > 0 ) {
+        if ( poll( &pfd, 1, AD910X_CMD_IDLE_MS ) == 0 ) {
+            server->idle();
+            continue;
+        }
+        got = read( fd, buf, sizeof( buf ) );
+        for ( ssize_t i=0; i<got; i++ ) {
+            server->feed( buf[i] );
+        }
+    }
+}
+
+/*** Multi-bus rig: boards_per_bus boards on each bus, each with its own configuration ***/
+struct RigJob {
+    AD910x_ARRAY<8> *dev[4];
+    int boards_per_bus;
+};
+
+static void configure_bus( void *ctx, uint8_t bus ) {
+    RigJob *rig = (RigJob *)ctx;
+    for ( int d=0; d<rig->boards_per_bus; d++ ) {
+        rig->dev[bus]->AD910x_update_sram( AD910X_DEV( d ), ( d & 1 ) ? example2_4096_ramp : example1_RAM_gaussian );
+        rig->dev[bus]->AD910x_update_regs( AD910X_DEV( d ), ( d & 1 ) ? AD9106_example2_regval : AD9106_example1_regval );
+    }
+}
+
+/*** Producers sharing one bus through the worker ***/
+static void count_job( void *ctx, AD910x_Job & ) {
+    ( *(uint32_t *)ctx )++;
+}
+
+static void hold_job( void *ctx, AD910x_Job & ) {
+    while ( !( *(std::atomic<bool> *)ctx ).load() ) {
+        std::this_thread::yield();
+    }
+}
+
+struct StreamFeed {
+    AD910x_SINGLE *dev;
+    const int16_t *data;
+    uint16_t pos;
+};
+
+static int32_t feed_chunk( void *ctx ) {
+    StreamFeed *feed = (StreamFeed *)ctx;
+    uint16_t n = feed->dev->AD910x_stream_write( feed->data + feed->pos, 64 );
+    feed->pos += n;
+    return n;
+}
+
+static uint32_t elapsed_us( std::chrono::steady_clock::time_point t0 ) {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - t0 ).count();
+}
+
+int main() {
+    AD910x_SIM sim_single( 1 );
+    AD910x_SINGLE device_single( sim_single );
+    dev_stats = &device_single.stats;
+    device_single.log_level = AD910X_LOG_OFF;
+
+    device_single.spi_init( WORD_LEN, POL, FREQ );
+    device_single.AD910x_reg_reset();
+    fprintf( stderr, "SPI clock: %u Hz\n", sim_single.spi_hz() );
+    sim_single.reset_stats();
+
+    const uint32_t sram_hz[] = { FREQ, 25000000 };
+    for ( int k=0; k<2; k++ ) {
+        device_single.spi_init( WORD_LEN, POL, sram_hz[k] );
+        fprintf( stderr, "SRAM upload at %u Hz\n", sim_single.spi_hz() );
+        sim_single.reset_stats();
+        device_single.diff_en = false;
+        device_single.burst_en = false;
+        device_single.AD910x_update_sram( example1_RAM_gaussian );
+        report( sim_single, "update_sram per-word" );
+        device_single.burst_en = true;
+        device_single.AD910x_update_sram( example1_RAM_gaussian );
+        report( sim_single, "update_sram burst" );
+        device_single.diff_en = true;
+    }
+
+    // * Asynchronous upload at the last clock above, then back to FREQ * //
+    static uint16_t frames[AD910X_SRAM_FRAMES];
+    AD910x_BASE::AD910x_prepare_sram( frames, example2_4096_ramp, 0, AD910X_SRAM_SIZE );
+    sim_single.reset_stats();
+    if ( device_single.AD910x_update_sram_async( frames, AD910X_SRAM_SIZE ) != 0 || device_single.AD910x_finish_sram() != 0 ) {
+        fprintf( stderr, "Asynchronous SRAM upload failed\n" );
+        return 1;
+    }
+    report( sim_single, "update_sram_async" );
+    for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+        if ( sim_single.dev[0].sram[i] != (uint16_t)( example2_4096_ramp[i] << 2 ) ) {
+            fprintf( stderr, "SRAM mismatch at 0x%04X\n", AD910X_SRAM_ADDR + i );
+            return 1;
+        }
+    }
+    device_single.spi_init( WORD_LEN, POL, FREQ );
+    fprintf( stderr, "SRAM upload at %u Hz\n", sim_single.spi_hz() );
+    sim_single.reset_stats();
+
+    device_single.AD910x_update_sram( example1_RAM_gaussian );
+    report( sim_single, "update_sram ramp->gaussian" );
+    device_single.AD910x_update_sram( example5_RAM_gaussian );
+    report( sim_single, "update_sram example1->5" );
+
+    // * Sweep step: rescale 300 samples of the pulse * //
+    static int16_t sweep[AD910X_SRAM_SIZE];
+    memcpy( sweep, example1_RAM_gaussian, sizeof( sweep ) );
+    for ( int i=1900; i<2200; i++ ) {
+        sweep[i] = sweep[i] * 3 / 4;
+    }
+    device_single.AD910x_update_sram( sweep );
+    report( sim_single, "update_sram sweep step" );
+    for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+        if ( sim_single.dev[0].sram[i] != (uint16_t)( sweep[i] << 2 ) ) {
+            fprintf( stderr, "SRAM mismatch at 0x%04X\n", AD910X_SRAM_ADDR + i );
+            return 1;
+        }
+    }
+
+    // * Packed waveforms: size, decode rate and upload against the plain arrays * //
+    const int16_t *waves[] = { example1_RAM_gaussian, example2_4096_ramp, sweep };
+    const char *wave_names[] = { "gaussian", "ramp", "sweep step" };
+    static uint8_t packed[3][AD910X_SRAM_SIZE * 2];
+    AD910x_PackedWave packed_wave[3];
+    for ( int k=0; k<3; k++ ) {
+        uint32_t size = AD910x_pack_wave( waves[k], AD910X_SRAM_SIZE, packed[k], sizeof( packed[k] ) );
+        packed_wave[k] = { AD910X_SRAM_SIZE, (uint16_t)size, packed[k] };
+        fprintf( stderr, "packed %-12s %5u bytes (%.2f%% of %u)\n", wave_names[k], size,
+                100.0 * size / sizeof( sweep ), (unsigned)sizeof( sweep ) );
+    }
+
+    static int16_t decoded[AD910X_SRAM_SIZE];
+    for ( int k=0; k<3; k++ ) {
+        const int rounds = 2000;
+        auto t0 = std::chrono::steady_clock::now();
+        for ( int r=0; r<rounds; r++ ) {
+            AD910x_WaveDecoder dec( packed_wave[k] );
+            uint16_t got = 0;
+            while ( ( got += dec.read( decoded + got, AD910X_BURST_CHUNK ) ) < AD910X_SRAM_SIZE ) {
+            }
+        }
+        double s = std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+        fprintf( stderr, "decode %-12s %8.1f Msamples/s\n", wave_names[k], rounds * AD910X_SRAM_SIZE / s / 1e6 );
+        if ( memcmp( decoded, waves[k], sizeof( decoded ) ) != 0 ) {
+            fprintf( stderr, "Decoded %s differs\n", wave_names[k] );
+            return 1;
+        }
+    }
+
+    device_single.diff_en = false;
+    device_single.AD910x_update_sram( example1_RAM_gaussian );
+    report( sim_single, "update_sram array" );
+    if ( device_single.AD910x_update_sram_packed( packed_wave[0] ) != 0 ) {
+        fprintf( stderr, "Packed SRAM upload failed\n" );
+        return 1;
+    }
+    report( sim_single, "update_sram_packed" );
+    device_single.diff_en = true;
+    const int order[] = { 1, 0, 2 };
+    const char *order_names[] = { "packed gaussian->ramp", "packed ramp->gaussian", "packed sweep step" };
+    for ( int m=0; m<3; m++ ) {
+        int k = order[m];
+        device_single.AD910x_update_sram_packed( packed_wave[k] );
+        report( sim_single, order_names[m] );
+        for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+            if ( sim_single.dev[0].sram[i] != (uint16_t)( waves[k][i] << 2 ) ) {
+                fprintf( stderr, "SRAM mismatch at 0x%04X\n", AD910X_SRAM_ADDR + i );
+                return 1;
+            }
+        }
+    }
+
+    // * Sample to wire format conversion against a scalar reference * //
+    static int16_t conv16[AD910X_SRAM_SIZE];
+    static int32_t conv32[AD910X_SRAM_SIZE];
+    static float convf[AD910X_SRAM_SIZE];
+    static uint16_t ref16[AD910X_SRAM_SIZE], ref32[AD910X_SRAM_SIZE], reff[AD910X_SRAM_SIZE];
+    for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+        conv16[i] = ( i * 37 ) % 20000 - 10000;
+        conv32[i] = ( i - 2048 ) * 6000;
+        convf[i] = ( i - 2048 ) / 1800.0f;
+        int32_t c = conv16[i] < -8192 ? -8192 : conv16[i] > 8191 ? 8191 : conv16[i];
+        ref16[i] = (uint16_t)( (uint32_t)c << 2 );
+        c = conv32[i] < -8192 ? -8192 : conv32[i] > 8191 ? 8191 : conv32[i];
+        ref32[i] = (uint16_t)( (uint32_t)c << 2 );
+        float f = convf[i] * 8192.0f;
+        c = f < -8192.0f ? -8192 : f > 8191.0f ? 8191 : (int32_t)lrintf( f );
+        reff[i] = (uint16_t)( (uint32_t)c << 2 );
+    }
+    const char *conv_names[] = { "int16", "int32", "float" };
+    for ( int k=0; k<3; k++ ) {
+        const int rounds = 20000;
+        auto t0 = std::chrono::steady_clock::now();
+        for ( int r=0; r<rounds; r++ ) {
+            if ( k == 0 ) {
+                AD910x_to_wire( &frames[1], conv16, AD910X_SRAM_SIZE - ( r & 7 ) );
+            } else if ( k == 1 ) {
+                AD910x_to_wire( &frames[1], conv32, AD910X_SRAM_SIZE - ( r & 7 ) );
+            } else {
+                AD910x_to_wire( &frames[1], convf, AD910X_SRAM_SIZE - ( r & 7 ) );
+            }
+        }
+        double s = std::chrono::duration<double>( std::chrono::steady_clock::now() - t0 ).count();
+        fprintf( stderr, "to_wire %-11s %8.1f Msamples/s\n", conv_names[k], rounds * ( AD910X_SRAM_SIZE - 3.5 ) / s / 1e6 );
+        const uint16_t *ref = ( k == 0 ) ? ref16 : ( k == 1 ) ? ref32 : reff;
+        if ( memcmp( &frames[1], ref, sizeof( ref16 ) ) != 0 ) {
+            fprintf( stderr, "Wire format of %s samples differs\n", conv_names[k] );
+            return 1;
+        }
+    }
+
+    device_single.reg_cache_en = false;
+    device_single.log_level = AD910X_LOG_FULL;
+    device_single.AD910x_update_regs( AD9106_example3_regval );
+    report( sim_single, "update_regs uncached+dump" );
+    device_single.log_level = AD910X_LOG_OFF;
+    device_single.burst_en = false;
+    device_single.AD910x_update_regs( AD9106_example3_regval );
+    report( sim_single, "update_regs uncached single" );
+    device_single.burst_en = true;
+    device_single.AD910x_update_regs( AD9106_example3_regval );
+    report( sim_single, "update_regs uncached" );
+    device_single.reg_cache_en = true;
+    device_single.AD910x_update_regs( AD9106_example3_regval );
+    report( sim_single, "update_regs example3 again" );
+    device_single.AD910x_update_regs( AD9106_example6_regval );
+    report( sim_single, "update_regs example3->6" );
+    for ( int i=0; i<66; i++ ) {
+        uint16_t addr = AD910x_BASE::reg_add[i];
+        if ( addr != AD910X_REG_RAMUPDATE && sim_single.dev[0].regs[addr] != AD9106_example6_regval[i] ) {
+            fprintf( stderr, "Register 0x%04X mismatch\n", addr );
+            return 1;
+        }
+    }
+
+    // * Cost of each readback mode on a fresh register set and SRAM image, then fault detection * //
+    const char *verify_names[] = { "none", "final", "sampled", "full" };
+    for ( uint8_t mode=AD910X_VERIFY_NONE; mode<=AD910X_VERIFY_FULL; mode++ ) {
+        char name[40];
+        device_single.verify_mode = mode;
+        device_single.AD910x_invalidate_sram();
+        device_single.AD910x_update_sram( mode & 1 ? example1_RAM_gaussian : example2_4096_ramp );
+        snprintf( name, sizeof( name ), "update_sram verify %s", verify_names[mode] );
+        report( sim_single, name );
+        device_single.AD910x_update_regs( mode & 1 ? AD9106_example3_regval : AD9106_example6_regval );
+        snprintf( name, sizeof( name ), "update_regs verify %s", verify_names[mode] );
+        report( sim_single, name );
+        if ( device_single.verify_result.mismatches != 0 ) {
+            fprintf( stderr, "Verify %s reported %u mismatches on a clean link\n", verify_names[mode],
+                    device_single.verify_result.mismatches );
+            return 1;
+        }
+    }
+    device_single.verify_mode = AD910X_VERIFY_NONE;
+    sim_single.dev[0].sram[100] ^= 0x0004;
+    sim_single.dev[0].regs[AD910X_REG_PAT_PERIOD] ^= 0x0100;
+    const AD910x_VerifyResult &vr = device_single.AD910x_verify( AD910X_VERIFY_FULL );
+    report( sim_single, "verify full" );
+    fprintf( stderr, "injected 2 faults: %u of %u words differ\n", vr.mismatches, vr.checked );
+    for ( int i=0; i<vr.recorded; i++ ) {
+        fprintf( stderr, "  dev %u 0x%04X: expected 0x%04X, read 0x%04X\n", vr.mismatch[i].dev, vr.mismatch[i].addr,
+                vr.mismatch[i].expected, vr.mismatch[i].actual );
+    }
+    if ( vr.mismatches != 2 ) {
+        return 1;
+    }
+    device_single.AD910x_invalidate_sram();
+    device_single.AD910x_invalidate_regs();
+    device_single.AD910x_update_sram( example1_RAM_gaussian );
+    device_single.AD910x_update_regs( AD9106_example6_regval );
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * Short pulses: two 256-word waveforms kept in SRAM at once, located by START_ADDRx/STOP_ADDRx * //
+    static int16_t pulses[AD910X_SRAM_SIZE];
+    uint16_t pulse_regs[66];
+    memcpy( pulse_regs, AD9106_example1_regval, sizeof( pulse_regs ) );
+    for ( int i=0; i<66; i++ ) {
+        uint16_t addr = AD910x_BASE::reg_add[i];
+        if ( addr == AD910X_REG_START_ADDR( 0 ) || addr == AD910X_REG_START_ADDR( 1 ) ) {
+            pulse_regs[i] = 0x0000;
+        } else if ( addr == AD910X_REG_STOP_ADDR( 0 ) || addr == AD910X_REG_STOP_ADDR( 1 ) ) {
+            pulse_regs[i] = 255 << AD910X_SRAM_ADDR_SHIFT;
+        } else if ( addr == AD910X_REG_START_ADDR( 2 ) || addr == AD910X_REG_START_ADDR( 3 ) ) {
+            pulse_regs[i] = 2048 << AD910X_SRAM_ADDR_SHIFT;
+        } else if ( addr == AD910X_REG_STOP_ADDR( 2 ) || addr == AD910X_REG_STOP_ADDR( 3 ) ) {
+            pulse_regs[i] = 2303 << AD910X_SRAM_ADDR_SHIFT;
+        }
+    }
+    for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+        pulses[i] = ( i & 0x7FF ) < 256 ? ( i * 61 ) % 8000 - 4000 : 0;
+    }
+    AD910x_SramRange ranges[AD910X_CHANNELS];
+    uint8_t num_ranges = AD910x_BASE::AD910x_sram_ranges( pulse_regs, ranges );
+    fprintf( stderr, "pulse registers play %u SRAM range(s):", num_ranges );
+    for ( int i=0; i<num_ranges; i++ ) {
+        fprintf( stderr, " 0x%04X+%u", AD910X_SRAM_ADDR + ranges[i].offset, ranges[i].n );
+    }
+    fprintf( stderr, "\n" );
+    device_single.AD910x_invalidate_sram();
+    device_single.AD910x_update_sram( pulses );
+    report( sim_single, "update_sram full image" );
+    device_single.AD910x_invalidate_sram();
+    int used = device_single.AD910x_update_sram_used( pulses, pulse_regs );
+    report( sim_single, "update_sram_used" );
+    device_single.AD910x_invalidate_sram();
+    device_single.AD910x_update_sram_range( 0, 256, pulses );
+    report( sim_single, "update_sram_range 256" );
+    if ( used != 512 || device_single.AD910x_update_sram_range( 4000, 200, pulses ) != -1 ) {
+        fprintf( stderr, "SRAM range upload wrong\n" );
+        return 1;
+    }
+    for ( int i=0; i<num_ranges; i++ ) {
+        for ( int j=ranges[i].offset; j<ranges[i].offset + ranges[i].n; j++ ) {
+            if ( sim_single.dev[0].sram[j] != (uint16_t)( pulses[j] << 2 ) ) {
+                fprintf( stderr, "SRAM mismatch at 0x%04X after range upload\n", AD910X_SRAM_ADDR + j );
+                return 1;
+            }
+        }
+    }
+    // * An upload refused because another is open must say so and send nothing * //
+    device_single.AD910x_stream_begin( 0, 16 );
+    sim_single.reset_stats();
+    if ( device_single.AD910x_update_sram( pulses ) != -1 || device_single.AD910x_update_sram_range( 0, 256, pulses ) != -1 ||
+            device_single.AD910x_update_sram_used( pulses, pulse_regs ) != -1 || sim_single.stats.frames != 0 ) {
+        fprintf( stderr, "SRAM upload during an open stream reported success\n" );
+        return 1;
+    }
+    device_single.AD910x_stream_end();
+    device_single.AD910x_invalidate_sram();
+    device_single.AD910x_update_sram( example1_RAM_gaussian );
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * Binary dump of registers and SRAM, decoded and compared with the simulator * //
+    static DumpBuffer dump;
+    dump.len = 0;
+    int32_t dumped = device_single.AD910x_dump( AD910X_SRAM_SIZE, dump_to_buffer, &dump );
+    report( sim_single, "dump regs+sram" );
+    AD910x_DumpDecoder dump_dec;
+    uint32_t dump_frames = 0;
+    uint32_t dump_words = 0;
+    for ( uint32_t i=0; i<dump.len; i++ ) {
+        if ( !dump_dec.feed( dump.data[i] ) || dump_dec.type == AD910X_DUMP_END ) {
+            continue;
+        }
+        dump_frames++;
+        for ( int j=0; j<dump_dec.n; j++, dump_words++ ) {
+            uint16_t addr = dump_dec.addr + j;
+            uint16_t want = ( addr >= AD910X_SRAM_ADDR ) ? sim_single.dev[0].sram[addr - AD910X_SRAM_ADDR] : sim_single.dev[0].regs[addr];
+            if ( dump_dec.data[j] != want ) {
+                fprintf( stderr, "Dump differs at 0x%04X\n", addr );
+                return 1;
+            }
+        }
+    }
+    // * ASCII dump: "0x%04X, 0x%04X\n" per word at 115200 baud, 10 bits per byte * //
+    fprintf( stderr, "dump: %d bytes, %u frames, %u words, %.0f ms at %d baud (ASCII: %u bytes, %.0f ms at 115200)\n",
+            dumped, dump_frames, dump_words, dumped * 10e3 / 921600, 921600, dump_words * 16, dump_words * 16 * 10e3 / 115200 );
+    dump.data[1000] ^= 0x40;
+    dump_dec = AD910x_DumpDecoder();
+    dump_frames = 0;
+    for ( uint32_t i=0; i<dump.len; i++ ) {
+        dump_frames += dump_dec.feed( dump.data[i] ) && dump_dec.type != AD910X_DUMP_END;
+    }
+    if ( dumped != (int32_t)dump.len || dump_dec.crc_errors != 1 || dump_frames + 1 != dump_dec.addr ) {
+        fprintf( stderr, "Corrupted dump frame not detected\n" );
+        return 1;
+    }
+
+    // * Preset library: the six AD9106 examples cycled in a test sequence, full reloads against delta switches * //
+    const char *const preset_name[6] = { "example1", "example2", "example3", "example4", "example5", "example6" };
+    const uint16_t *const preset_regs[6] = { AD9106_example1_regval, AD9106_example2_regval, AD9106_example3_regval,
+            AD9106_example4_regval, AD9106_example5_regval, AD9106_example6_regval };
+    const int16_t *const preset_sram[6] = { example1_RAM_gaussian, example2_4096_ramp, NULL, NULL, example5_RAM_gaussian, NULL };
+    const uint8_t sequence[] = { 0, 1, 2, 3, 4, 5, 0, 4, 2, 5, 1, 0, 2, 3 };
+    const int steps = sizeof( sequence );
+    AD910x_PresetLib presets( device_single, 0x1 );
+    for ( int i=0; i<6; i++ ) {
+        presets.add( { preset_name[i], preset_regs[i], preset_sram[i], NULL, AD910X_TRIG_START } );
+    }
+    
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_invalidate_sram();
+    device_single.diff_en = false;
+    device_single.reg_cache_en = false;
+    sim_single.reset_stats();
+    for ( int i=0; i<steps; i++ ) {
+        if ( preset_sram[sequence[i]] != NULL ) {
+            device_single.AD910x_update_sram( preset_sram[sequence[i]] );
+        }
+        device_single.AD910x_update_regs( preset_regs[sequence[i]] );
+        device_single.AD910x_start_pattern();
+    }
+    double reload_ms = sim_single.time_ns() / 1e6;
+    report( sim_single, "preset sequence, reload" );
+    device_single.diff_en = true;
+    device_single.reg_cache_en = true;
+    
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_invalidate_sram();
+    sim_single.reset_stats();
+    uint32_t preset_us = 0;
+    for ( int i=0; i<steps; i++ ) {
+        uint8_t from = presets.active();
+        int32_t us = presets.select( preset_name[sequence[i]] );
+        const AD910x_Transition &t = presets.transition( from, sequence[i] );
+        if ( us < 0 || presets.active() != sequence[i] || !sim_single.running() ) {
+            fprintf( stderr, "Preset switch to %s failed\n", preset_name[sequence[i]] );
+            return 1;
+        }
+        fprintf( stderr, "  %-8s -> %-8s %6d us  regs %2u  sram %4u\n", ( from == AD910X_PRESET_NONE ) ? "reset" : preset_name[from],
+                preset_name[sequence[i]], us, t.regs, t.sram );
+        preset_us += us;
+    }
+    report( sim_single, "preset sequence, delta" );
+    fprintf( stderr, "preset sequence of %d switches: reload %.3f ms, delta %.3f ms\n", steps, reload_ms, preset_us / 1e3 );
+    uint8_t last = sequence[steps - 1];
+    for ( int i=0; i<66; i++ ) {
+        uint16_t addr = AD910x_BASE::reg_add[i];
+        if ( addr != AD910X_REG_RAMUPDATE && addr != AD910X_REG_PAT_STATUS && sim_single.dev[0].regs[addr] != preset_regs[last][i] ) {
+            fprintf( stderr, "Register 0x%04X differs after preset switches\n", addr );
+            return 1;
+        }
+    }
+    if ( presets.select( "missing" ) != -1 || presets.find( "example4" ) != 3 ) {
+        fprintf( stderr, "Preset lookup wrong\n" );
+        return 1;
+    }
+    // * A switch whose SRAM write is refused must fail and not name the preset * //
+    device_single.AD910x_stream_begin( 0, 16 );
+    device_single.diff_en = false;
+    int32_t refused = presets.select( "example1" );
+    device_single.AD910x_stream_end();
+    if ( refused != -1 || presets.active() != AD910X_PRESET_NONE || device_single.diff_en || !device_single.reg_cache_en ) {
+        fprintf( stderr, "Preset switch with a refused SRAM write reported success\n" );
+        return 1;
+    }
+    device_single.diff_en = true;
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * Pattern changes: stop, reload and start, then a register-only change latched by RAMUPDATE during playback * //
+    static int16_t change_wave[4][1024];
+    uint16_t change_regs[66];
+    uint16_t short_regs[66];
+    memcpy( change_regs, AD9106_example1_regval, sizeof( change_regs ) );
+    for ( int i=0; i<66; i++ ) {
+        for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+            if ( AD910x_BASE::reg_add[i] == AD910X_REG_START_ADDR( ch ) ) {
+                change_regs[i] = 0x0000;
+            } else if ( AD910x_BASE::reg_add[i] == AD910X_REG_STOP_ADDR( ch ) ) {
+                change_regs[i] = 1023 << AD910X_SRAM_ADDR_SHIFT;
+            }
+        }
+    }
+    memcpy( short_regs, change_regs, sizeof( short_regs ) );
+    for ( int i=0; i<66; i++ ) {
+        for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+            if ( AD910x_BASE::reg_add[i] == AD910X_REG_STOP_ADDR( ch ) ) {
+                short_regs[i] = 511 << AD910X_SRAM_ADDR_SHIFT;
+            }
+        }
+    }
+    for ( int k=0; k<4; k++ ) {
+        for ( int i=0; i<1024; i++ ) {
+            change_wave[k][i] = (int16_t)( 6000 * sin( M_PI * i / 1024 ) * ( ( i % ( 64 << k ) ) < ( 32 << k ) ) );
+        }
+    }
+    
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_invalidate_sram();
+    device_single.AD910x_update_sram_range( 0, 1024, change_wave[3] );
+    device_single.AD910x_update_regs( change_regs );
+    device_single.AD910x_start_pattern();
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+    for ( int k=0; k<4; k++ ) {
+        device_single.AD910x_stop_pattern();
+        device_single.AD910x_update_sram_range( 0, 1024, change_wave[k] );
+        device_single.AD910x_update_regs( change_regs );
+        device_single.AD910x_start_pattern();
+    }
+    double reload_dead_ms = sim_single.stats.stopped_ns / 1e6;
+    report( sim_single, "4 changes, stop/reload" );
+    
+    // * The register set is staged and latched by the trailing RAMUPDATE, so the pattern never stops * //
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+    device_single.AD910x_update_regs( short_regs );
+    const AD910x_SIM::Device &latched = sim_single.dev[0];
+    if ( sim_single.stats.stopped_ns != 0 || !sim_single.running() || !( latched.active[AD910X_REG_PAT_STATUS] & AD910X_PAT_RUN ) ||
+            latched.active[AD910X_REG_STOP_ADDR( 0 )] != 511 << AD910X_SRAM_ADDR_SHIFT ) {
+        fprintf( stderr, "Register-only change stopped the pattern or was not latched\n" );
+        return 1;
+    }
+    fprintf( stderr, "pattern change: stop/reload %.3f ms without output per change; register-only change during playback "
+            "%u registers, %.3f ms, no stop\n", reload_dead_ms / 4, device_single.stats.reg_written, sim_single.time_ns() / 1e6 );
+    device_single.AD910x_stop_pattern();
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * Shared bus: a full SRAM upload, a register sweep and status reads from three threads through one worker * //
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_invalidate_sram();
+    sim_single.reset_stats();
+    AD910x_Worker worker( device_single );
+    worker.start();
+
+    AD910x_Job upload;
+    upload.type = AD910X_JOB_SRAM;
+    upload.dev_mask = 0x1;
+    upload.n = AD910X_SRAM_SIZE;
+    upload.data = example2_4096_ramp;
+    std::thread host_side( [&] {
+        worker.submit( upload );
+        worker.wait( upload );
+    } );
+
+    const uint16_t sweep_addr[2] = { AD910X_REG_PAT_PERIOD - 1, AD910X_REG_PAT_PERIOD };
+    static uint16_t sweep_val[200][2];
+    uint32_t sweep_done = 0, sweep_submit_max = 0, sweep_rejected = 0;
+    std::thread sweep_side( [&] {
+        AD910x_Job step[4];
+        for ( int i=0; i<200; i++ ) {
+            AD910x_Job &job = step[i % 4];
+            if ( job.state.load() != AD910X_JOB_IDLE ) {
+                worker.wait( job );
+            }
+            sweep_val[i][0] = 0x0111;
+            sweep_val[i][1] = (uint16_t)( 0x1000 + i );
+            job.type = AD910X_JOB_REGS;
+            job.dev_mask = 0x1;
+            job.addr = sweep_addr;
+            job.data = sweep_val[i];
+            job.n = 2;
+            job.done = count_job;
+            job.ctx = &sweep_done;
+            auto t0 = std::chrono::steady_clock::now();
+            sweep_rejected += ( worker.submit( job ) != 0 );
+            uint32_t us = elapsed_us( t0 );
+            sweep_submit_max = ( us > sweep_submit_max ) ? us : sweep_submit_max;
+        }
+        for ( int k=0; k<4; k++ ) {
+            worker.wait( step[k] );
+        }
+    } );
+
+    uint16_t status[2] = { 0, 0 };
+    int32_t status_n = 0;
+    std::thread ui_side( [&] {
+        AD910x_Job job;
+        job.type = AD910X_JOB_TRIGGER;
+        job.offset = 0;
+        worker.submit( job );
+        worker.wait( job );
+        job.type = AD910X_JOB_READ;
+        job.dev_mask = 0x1;
+        job.offset = AD910X_REG_PAT_STATUS;
+        job.n = 1;
+        job.out = status;
+        worker.submit( job );
+        status_n = worker.wait( job );
+    } );
+    host_side.join();
+    sweep_side.join();
+    ui_side.join();
+
+    // * Readback during playback: a queued SRAM read must leave RUN set * //
+    const uint16_t run_addr[1] = { AD910X_REG_PAT_STATUS };
+    uint16_t run_val[1] = { AD910X_PAT_RUN };
+    uint16_t run_back[64];
+    AD910x_Job run_job;
+    run_job.type = AD910X_JOB_REGS;
+    run_job.dev_mask = 0x1;
+    run_job.addr = run_addr;
+    run_job.data = run_val;
+    run_job.n = 1;
+    worker.submit( run_job );
+    worker.wait( run_job );
+    run_job.type = AD910X_JOB_READ;
+    run_job.offset = AD910X_SRAM_ADDR;
+    run_job.n = 64;
+    run_job.out = run_back;
+    worker.submit( run_job );
+    bool run_kept = ( worker.wait( run_job ) == 64 && ( sim_single.dev[0].active[AD910X_REG_PAT_STATUS] & AD910X_PAT_RUN ) &&
+            run_back[63] == sim_single.dev[0].sram[63] );
+    run_val[0] = 0x0000;
+    run_job.type = AD910X_JOB_REGS;
+    run_job.n = 1;
+    worker.submit( run_job );
+    worker.wait( run_job );
+
+    worker.stop();
+    if ( !run_kept ) {
+        fprintf( stderr, "Worker SRAM read stopped the pattern\n" );
+        return 1;
+    }
+
+    for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+        if ( sim_single.dev[0].sram[i] != (uint16_t)( example2_4096_ramp[i] << 2 ) || upload.result != 0 ) {
+            fprintf( stderr, "Worker SRAM upload mismatch at 0x%04X\n", AD910X_SRAM_ADDR + i );
+            return 1;
+        }
+    }
+    if ( sweep_rejected != 0 || sweep_done != 200 || sim_single.dev[0].regs[AD910X_REG_PAT_PERIOD] != 0x1000 + 199 ||
+            status_n != 1 || !sim_single.running() || worker.stats.completed != worker.submitted.load() ) {
+        fprintf( stderr, "Worker jobs lost or out of order\n" );
+        return 1;
+    }
+    report( sim_single, "worker: 3 producers" );
+    fprintf( stderr, "worker: %u jobs, queue depth max %u, wait avg %.1f us max %u us, run avg %.1f us max %u us, sweep submit max %u us\n",
+            worker.stats.completed, worker.stats.depth_max,
+            (double)worker.stats.wait_us_total / worker.stats.completed, worker.stats.wait_us_max,
+            (double)worker.stats.run_us_total / worker.stats.completed, worker.stats.run_us_max, sweep_submit_max );
+
+    // * Two producers racing to submit one job while the bus thread is held: exactly one may queue it * //
+    AD910x_Worker racer( device_single );
+    uint32_t double_queued = 0;
+    racer.start();
+    AD910x_Job hold;
+    hold.type = AD910X_JOB_TRIGGER;
+    hold.done = hold_job;
+    for ( int i=0; i<1000; i++ ) {
+        std::atomic<bool> release{ false };
+        std::atomic<int> accepted{ 0 };
+        hold.ctx = &release;
+        racer.submit( hold );
+        std::thread other( [&] { accepted += ( racer.submit( run_job ) == 0 ); } );
+        accepted += ( racer.submit( run_job ) == 0 );
+        other.join();
+        release.store( true );
+        racer.wait( hold );
+        racer.wait( run_job );
+        double_queued += ( accepted.load() != 1 );
+    }
+    racer.stop();
+    if ( double_queued != 0 ) {
+        fprintf( stderr, "Worker queued one job twice %u times\n", double_queued );
+        return 1;
+    }
+
+    // * A stream fed chunk by chunk through a worker with a register job between the chunks * //
+    AD910x_Worker mixer( device_single );
+    StreamFeed feed = { &device_single, example1_RAM_gaussian, 0 };
+    AD910x_Job chunk_job;
+    chunk_job.type = AD910X_JOB_CALL;
+    chunk_job.call = feed_chunk;
+    chunk_job.ctx = &feed;
+    const uint16_t period_addr[1] = { AD910X_REG_PAT_PERIOD };
+    uint16_t period_val[1];
+    AD910x_Job period_job;
+    period_job.type = AD910X_JOB_REGS;
+    period_job.dev_mask = 0x1;
+    period_job.addr = period_addr;
+    period_job.data = period_val;
+    period_job.n = 1;
+    mixer.start();
+    device_single.AD910x_invalidate_sram();
+    sim_single.reset_stats();
+    device_single.AD910x_stream_begin( 0, AD910X_SRAM_SIZE );
+    for ( int i=0; i<AD910X_SRAM_SIZE / 64; i++ ) {
+        mixer.submit( chunk_job );
+        mixer.wait( chunk_job );
+        period_val[0] = 0x2000 + i;
+        mixer.submit( period_job );
+        mixer.wait( period_job );
+    }
+    device_single.AD910x_stream_end();
+    mixer.stop();
+    for ( int i=0; i<AD910X_SRAM_SIZE; i++ ) {
+        if ( sim_single.dev[0].sram[i] != (uint16_t)( example1_RAM_gaussian[i] << 2 ) ) {
+            fprintf( stderr, "Register job corrupted the open stream at 0x%04X\n", AD910X_SRAM_ADDR + i );
+            return 1;
+        }
+    }
+    if ( sim_single.dev[0].regs[AD910X_REG_PAT_PERIOD] != 0x2000 + AD910X_SRAM_SIZE / 64 - 1 || sim_single.stats.access_errors != 0 ) {
+        fprintf( stderr, "Register job between stream chunks lost\n" );
+        return 1;
+    }
+    report( sim_single, "stream of 64 chunks with a register job between each" );
+    device_single.AD910x_stop_pattern();
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * DDS sweep: bus cost of a chirp step at three SPI clocks against a full register pass, then the timer cadence * //
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_update_regs( AD9106_example6_regval );
+    device_single.AD910x_start_pattern();
+    AD910x_Sweep dds( device_single, 0x1, DAC_CLK );
+    if ( dds.chirp( 1e6f, 10e6f, 256 ) != 256 || AD910x_Sweep::tuning_word( DAC_CLK / 4.0f, DAC_CLK ) != 0x400000 ) {
+        fprintf( stderr, "Chirp table not filled\n" );
+        return 1;
+    }
+    const uint32_t sweep_hz[] = { FREQ, 12500000, 50000000 };
+    for ( int k=0; k<3; k++ ) {
+        device_single.spi_init( WORD_LEN, POL, sweep_hz[k] );
+        device_single.reg_cache_en = false;
+        sim_single.reset_stats();
+        device_single.AD910x_update_regs( AD9106_example6_regval );
+        double full_us = sim_single.time_ns() / 1e3;
+        device_single.reg_cache_en = true;
+        dds.reset_stats();
+        sim_single.reset_stats();
+        for ( int i=0; i<256; i++ ) {
+            dds.step();
+            const AD910x_SIM::Device &d = sim_single.dev[0];
+            if ( d.active[AD910X_REG_DDS_TW32] != dds.steps[i].tw32 || d.active[AD910X_REG_DDS_TW1] != dds.steps[i].tw1 ) {
+                fprintf( stderr, "Sweep step %d not latched\n", i );
+                return 1;
+            }
+        }
+        fprintf( stderr, "chirp 256 steps at %8u Hz: %u frames, %4u us per step (full register pass %7.1f us), max %6u steps/s\n",
+                sim_single.spi_hz(), dds.stats.frames_max, dds.stats.bus_us_max, full_us, dds.max_rate_hz() );
+    }
+
+    const float code_hz[4] = { 5e6f, 5e6f, 5e6f, 5e6f };
+    const float code_deg[4] = { 0, 90, 180, 270 };
+    dds.table( code_hz, code_deg, 4, 0x1 );
+    dds.step();
+    dds.reset_stats();
+    for ( int i=1; i<4; i++ ) {
+        dds.step();
+        if ( sim_single.dev[0].active[AD910X_REG_DDS_PW( 0 )] != ( i << 14 ) ) {
+            fprintf( stderr, "Phase step %d not latched\n", i );
+            return 1;
+        }
+    }
+    if ( dds.stats.frames_max != 4 ) {
+        fprintf( stderr, "Phase steps rewrote the tuning word\n" );
+        return 1;
+    }
+
+    dds.chirp( 1e6f, 10e6f, 256 );
+    dds.reset_stats();
+    dds.step();
+    if ( dds.start( dds.stats.bus_us_max / 2, true ) != -1 ) {
+        fprintf( stderr, "Sweep period below the bus time accepted\n" );
+        return 1;
+    }
+    AD910x_Sweep fresh( device_single, 0x1, DAC_CLK );
+    fresh.chirp( 1e6f, 10e6f, 256 );
+    if ( fresh.start( 1, true ) != -1 || fresh.running() || fresh.max_rate_hz() == 0 || fresh.stats.steps != 1 ) {
+        fprintf( stderr, "Sweep period accepted before a step was measured\n" );
+        return 1;
+    }
+    dds.chirp( 1e6f, 10e6f, 256 );
+    dds.reset_stats();
+    dds.start( 200, false );
+    while ( dds.running() ) {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+    }
+    dds.stop();
+    if ( dds.stats.steps != 256 || dds.pos != 0 ) {
+        fprintf( stderr, "Timed sweep ran %u steps\n", dds.stats.steps );
+        return 1;
+    }
+    fprintf( stderr, "timed chirp at 200 us: jitter avg %.1f us max %u us, latest start %u us, %u overruns\n",
+            (double)dds.stats.jitter_us_total / ( dds.stats.steps - 1 ), dds.stats.jitter_us_max,
+            dds.stats.late_us_max, dds.stats.overruns );
+
+    // * The same chirp queued through a worker while another producer reads the tuning word back * //
+    AD910x_Worker dds_bus( device_single );
+    dds_bus.start();
+    AD910x_Sweep shared( device_single, 0x1, DAC_CLK, &dds_bus );
+    shared.chirp( 1e6f, 10e6f, 256 );
+    uint32_t tw_reads = 0;
+    uint16_t tw_back[2];
+    shared.start( 200, false );
+    while ( shared.running() ) {
+        AD910x_Job job;
+        job.type = AD910X_JOB_READ;
+        job.dev_mask = 0x1;
+        job.offset = AD910X_REG_DDS_TW32;
+        job.n = 2;
+        job.out = tw_back;
+        dds_bus.submit( job );
+        tw_reads += ( dds_bus.wait( job ) == 2 );
+    }
+    shared.stop();
+    dds_bus.stop();
+    if ( shared.stats.steps != 256 || shared.pos != 0 || tw_reads == 0 ||
+            sim_single.dev[0].active[AD910X_REG_DDS_TW32] != shared.steps[255].tw32 ) {
+        fprintf( stderr, "Shared sweep ran %u steps\n", shared.stats.steps );
+        return 1;
+    }
+    fprintf( stderr, "timed chirp at 200 us through a worker: %u readbacks between the steps, %u ticks skipped\n",
+            tw_reads, shared.stats.overruns );
+    device_single.AD910x_stop_pattern();
+    device_single.spi_init( WORD_LEN, POL, FREQ );
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * Closed-loop amplitude control: gain and offset batches of 1..4 channels against register passes * //
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_update_regs( AD9106_example3_regval );
+    device_single.AD910x_start_pattern();
+    for ( int k=0; k<2; k++ ) {
+        device_single.spi_init( WORD_LEN, POL, k ? 12500000 : FREQ );
+        for ( int nch=1; nch<=AD910X_CHANNELS; nch++ ) {
+            AD910x_ChannelBatch batch = {};
+            uint16_t regs[66];
+            double ms[3] = { 0, 0, 0 };
+            double cpu_us[3] = { 0, 0, 0 };
+            memcpy( regs, AD9106_example3_regval, sizeof( regs ) );
+            for ( int mode=0; mode<3; mode++ ) {
+                device_single.reg_cache_en = ( mode != 2 );
+                sim_single.reset_stats();
+                auto t0 = std::chrono::steady_clock::now();
+                for ( int i=0; i<100; i++ ) {
+                    batch.gain_set = batch.offset_set = (uint8_t)( ( 1 << nch ) - 1 );
+                    for ( int ch=0; ch<nch; ch++ ) {
+                        batch.gain[ch] = (int16_t)( AD910X_DGAIN_UNITY - 4 * i - ch - 100 * mode );
+                        batch.offset[ch] = (int16_t)( i - 50 + ch + 100 * mode );
+                        for ( int r=0; r<66; r++ ) {
+                            if ( AD910x_BASE::reg_add[r] == AD910X_REG_DGAIN( ch ) ) {
+                                regs[r] = (uint16_t)( (uint16_t)batch.gain[ch] << AD910X_CHAN_SHIFT );
+                            } else if ( AD910x_BASE::reg_add[r] == AD910X_REG_DOF( ch ) ) {
+                                regs[r] = (uint16_t)( (uint16_t)batch.offset[ch] << AD910X_CHAN_SHIFT );
+                            }
+                        }
+                    }
+                    if ( mode == 0 ) {
+                        device_single.AD910x_update_channels( batch );
+                    } else {
+                        device_single.AD910x_update_regs( regs );
+                    }
+                }
+                cpu_us[mode] = elapsed_us( t0 ) / 100.0;
+                ms[mode] = sim_single.time_ns() / 1e6;
+                const AD910x_SIM::Device &d = sim_single.dev[0];
+                for ( int ch=0; ch<nch; ch++ ) {
+                    if ( d.active[AD910X_REG_DGAIN( ch )] != (uint16_t)( (uint16_t)batch.gain[ch] << AD910X_CHAN_SHIFT ) ||
+                            d.active[AD910X_REG_DOF( ch )] != (uint16_t)( (uint16_t)batch.offset[ch] << AD910X_CHAN_SHIFT ) ) {
+                        fprintf( stderr, "Channel %d gain/offset not latched\n", ch );
+                        return 1;
+                    }
+                }
+            }
+            fprintf( stderr, "gain+offset of %d channel%s at %8u Hz: batch %6.0f/s (%4.2f us host), cached register pass %6.0f/s (%4.2f us host), full register pass %5.0f/s\n",
+                    nch, ( nch > 1 ) ? "s" : " ", sim_single.spi_hz(), 100e3 / ms[0], cpu_us[0], 100e3 / ms[1], cpu_us[1], 100e3 / ms[2] );
+        }
+    }
+    device_single.reg_cache_en = true;
+    AD910x_ChannelBatch same = {};
+    same.gain_set = 0x1;
+    same.gain[0] = (int16_t)( sim_single.dev[0].regs[AD910X_REG_DGAIN( 0 )] ) >> AD910X_CHAN_SHIFT;
+    sim_single.reset_stats();
+    if ( device_single.AD910x_update_channels( same ) != 0 || sim_single.stats.frames != 0 ) {
+        fprintf( stderr, "Unchanged batch was sent\n" );
+        return 1;
+    }
+    same.gain[0] = 3000;
+    if ( device_single.AD910x_update_channels( same ) != -1 ) {
+        fprintf( stderr, "Gain beyond 12 bits accepted\n" );
+        return 1;
+    }
+    // * An unchanged channel before a value out of range: nothing sent, nothing counted * //
+    same.gain_set = 0x3;
+    same.gain[0] = (int16_t)( sim_single.dev[0].regs[AD910X_REG_DGAIN( 0 )] ) >> AD910X_CHAN_SHIFT;
+    same.gain[1] = -3000;
+    uint32_t skipped_before = device_single.stats.reg_skipped;
+    if ( device_single.AD910x_update_channels( same ) != -1 || device_single.stats.reg_skipped != skipped_before ||
+            sim_single.stats.frames != 0 ) {
+        fprintf( stderr, "Rejected batch was counted or sent\n" );
+        return 1;
+    }
+    device_single.AD910x_stop_pattern();
+    device_single.spi_init( WORD_LEN, POL, FREQ );
+    sim_single.reset_stats();
+    memset( &device_single.stats, 0, sizeof( device_single.stats ) );
+
+    // * SPI clock training against wiring that is clean up to about 30 MHz * //
+    AD910x_SIM sim_train( 1 );
+    sim_train.link_max_hz = 40000000;
+    AD910x_SINGLE device_train( sim_train );
+    device_train.log_level = AD910X_LOG_OFF;
+    device_train.spi_init( WORD_LEN, POL, FREQ );
+    device_train.AD910x_reg_reset();
+    sim_train.reset_stats();
+    uint32_t trained = device_train.AD910x_train_spi( 50000000 );
+    fprintf( stderr, "SPI clock trained to %u Hz (fastest passing %u Hz) in %.3f ms, %u failed test(s)\n", trained,
+            device_train.spi_edge_hz, sim_train.time_ns() / 1e6, device_train.stats.link_errors );
+    if ( trained == 0 || trained >= device_train.spi_edge_hz ) {
+        fprintf( stderr, "SPI clock trained without margin\n" );
+        return 1;
+    }
+    sim_train.reset_stats();
+    device_train.AD910x_update_sram( example1_RAM_gaussian );
+    device_train.AD910x_update_regs( AD9106_example1_regval );
+    fprintf( stderr, "update_sram + update_regs at %u Hz: %.3f ms\n", sim_train.spi_hz(), sim_train.time_ns() / 1e6 );
+    for ( int i=0; i<AD910X_SRAM_SIZE - AD910X_BURST_CHUNK; i++ ) {
+        if ( sim_train.dev[0].sram[i] != (uint16_t)( example1_RAM_gaussian[i] << 2 ) ) {
+            fprintf( stderr, "SRAM mismatch at 0x%04X after training\n", AD910X_SRAM_ADDR + i );
+            return 1;
+        }
+    }
+    sim_train.link_max_hz = 20000000;
+    int link = device_train.AD910x_check_link();
+    fprintf( stderr, "link check after degrading the wiring: %d, SPI clock now %u Hz\n", link, device_train.spi_hz );
+    sim_train.link_max_hz = 12500000;
+    link = device_train.AD910x_check_link();
+    fprintf( stderr, "link check after degrading the wiring further: %d, SPI clock now %u Hz\n", link, device_train.spi_hz );
+    sim_train.link_max_hz = 100000;
+    int dead = device_train.AD910x_check_link();
+    sim_train.link_max_hz = 40000000;
+    int recovered = device_train.AD910x_check_link();
+    if ( dead != -1 || recovered != 1 || device_train.spi_hz == 0 ) {
+        fprintf( stderr, "Link check did not recover after a total failure (%d, %d)\n", dead, recovered );
+        return 1;
+    }
+    fprintf( stderr, "link check after a total failure and repair: SPI clock %u Hz\n", device_train.spi_hz );
+    // * A link check during playback: SRAM, PAT_PERIOD and PAT_STATUS as before * //
+    device_train.AD910x_update_sram( example1_RAM_gaussian );
+    device_train.AD910x_update_regs( AD9106_example1_regval );
+    device_train.AD910x_start_pattern();
+    uint16_t period_before = sim_train.dev[0].regs[AD910X_REG_PAT_PERIOD];
+    uint16_t status_before = sim_train.dev[0].active[AD910X_REG_PAT_STATUS];
+    int playing = device_train.AD910x_check_link();
+    bool restored = ( playing == 0 && sim_train.running() && ( status_before & AD910X_PAT_RUN ) &&
+            sim_train.dev[0].active[AD910X_REG_PAT_STATUS] == status_before &&
+            sim_train.dev[0].regs[AD910X_REG_PAT_PERIOD] == period_before );
+    for ( int i=0; i<AD910X_SRAM_SIZE && restored; i++ ) {
+        restored = ( sim_train.dev[0].sram[i] == (uint16_t)( example1_RAM_gaussian[i] << 2 ) );
+    }
+    device_train.AD910x_stop_pattern();
+    if ( !restored ) {
+        fprintf( stderr, "Link check disturbed the running pattern\n" );
+        return 1;
+    }
+
+    AD910x_SIM sim_multi( 2 );
+    AD910x_MULTI device_multi( sim_multi );
+    dev_stats = &device_multi.stats;
+    device_multi.log_level = AD910X_LOG_OFF;
+
+    device_multi.spi_init( WORD_LEN, POL, FREQ );
+    device_multi.AD910x_reg_reset();
+    sim_multi.reset_stats();
+
+    device_multi.AD910x_update_sram( false, example1_RAM_gaussian );
+    device_multi.AD910x_update_sram( true, example1_RAM_gaussian );
+    report( sim_multi, "multi update_sram x2" );
+    device_multi.AD910x_update_regs( false, AD9106_example1_regval );
+    device_multi.AD910x_update_regs( true, AD9106_example1_regval );
+    report( sim_multi, "multi update_regs x2" );
+
+    device_multi.AD910x_reg_reset();
+    sim_multi.reset_stats();
+    device_multi.AD910x_update_sram_all( example1_RAM_gaussian );
+    report( sim_multi, "multi update_sram broadcast" );
+    device_multi.AD910x_update_regs_all( AD9106_example1_regval );
+    report( sim_multi, "multi update_regs broadcast" );
+    int mismatches = device_multi.AD910x_verify_match( true );
+    report( sim_multi, "multi verify_match" );
+    device_multi.AD910x_update_regs( true, AD9106_example2_regval );
+    report( sim_multi, "multi update_regs device 2" );
+    int diverged = device_multi.AD910x_verify_match( false );
+    report( sim_multi, "multi verify_match regs" );
+    fprintf( stderr, "mismatches: %d after broadcast, %d after loading example 2 on device 2\n", mismatches, diverged );
+    if ( mismatches != 0 || diverged == 0 ) {
+        return 1;
+    }
+
+    // * N-board rig: configuration time per added board, one at a time and as a group * //
+    AD910x_SIM sim_array( 8 );
+    static AD910x_ARRAY<8> device_array( sim_array );
+    device_array.log_level = AD910X_LOG_OFF;
+    device_array.spi_init( WORD_LEN, POL, FREQ );
+    fprintf( stderr, "AD910x_ARRAY size: %u bytes for 1, %u for 2, %u for 4, %u for 8 devices\n",
+            (unsigned)sizeof( AD910x_ARRAY<1> ), (unsigned)sizeof( AD910x_ARRAY<2> ),
+            (unsigned)sizeof( AD910x_ARRAY<4> ), (unsigned)sizeof( AD910x_ARRAY<8> ) );
+    double prev_ms = 0;
+    for ( int k=1; k<=8; k++ ) {
+        device_array.AD910x_reg_reset();
+        sim_array.reset_stats();
+        for ( int d=0; d<k; d++ ) {
+            device_array.AD910x_update_sram( AD910X_DEV( d ), example1_RAM_gaussian );
+            device_array.AD910x_update_regs( AD910X_DEV( d ), AD9106_example1_regval );
+        }
+        double each_ms = sim_array.time_ns() / 1e6;
+
+        device_array.AD910x_reg_reset();
+        sim_array.reset_stats();
+        device_array.AD910x_update_sram( ( 1u << k ) - 1, example1_RAM_gaussian );
+        device_array.AD910x_update_regs( ( 1u << k ) - 1, AD9106_example1_regval );
+        double group_ms = sim_array.time_ns() / 1e6;
+        if ( device_array.AD910x_verify_match( ( 1u << k ) - 1, false ) != 0 ) {
+            fprintf( stderr, "Group write left %d boards different\n", k );
+            return 1;
+        }
+
+        fprintf( stderr, "%d boards: one at a time %8.3f ms (+%7.3f ms per board), group %7.3f ms\n",
+                k, each_ms, each_ms - prev_ms, group_ms );
+        prev_ms = each_ms;
+    }
+
+    // * Host command protocol over a PTY: the board side serves a simulated AD910x in its own thread * //
+    AD910x_SIM sim_cmd( 1 );
+    AD910x_SINGLE device_cmd( sim_cmd );
+    device_cmd.log_level = AD910X_LOG_OFF;
+    device_cmd.spi_init( WORD_LEN, POL, FREQ );
+    device_cmd.AD910x_reg_reset();
+    device_cmd.AD910x_train_spi( TRAIN_FREQ );
+    int pty = posix_openpt( O_RDWR | O_NOCTTY );
+    struct termios tio;
+    int tty = ( pty >= 0 && grantpt( pty ) == 0 && unlockpt( pty ) == 0 ) ? open( ptsname( pty ), O_RDWR | O_NOCTTY ) : -1;
+    if ( tty < 0 || tcgetattr( tty, &tio ) != 0 ) {
+        fprintf( stderr, "No PTY\n" );
+        return 1;
+    }
+    cfmakeraw( &tio );
+    tcsetattr( tty, TCSANOW, &tio );
+    AD910x_Worker cmd_bus( device_cmd );
+    cmd_bus.start();
+    AD910x_CmdServer server( device_cmd, pty_write, &pty, &cmd_bus );
+    std::thread board( serve_pty, &server, pty );
+    AD910x_Host host;
+    host.attach( tty );
+    
+    const int pings = 200;
+    auto t0 = std::chrono::steady_clock::now();
+    for ( int i=0; i<pings; i++ ) {
+        if ( host.ping() != 0 ) {
+            fprintf( stderr, "Ping failed\n" );
+            return 1;
+        }
+    }
+    double ping_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - t0 ).count() / pings;
+    
+    // * Pattern change: example 3 registers, a 512-sample pulse, start * //
+    static uint16_t cmd_regs[66];
+    for ( int i=0; i<66; i++ ) {
+        cmd_regs[i] = AD910x_BASE::reg_add[i];
+    }
+    sim_cmd.reset_stats();
+    t0 = std::chrono::steady_clock::now();
+    int ret = host.write_regs( 0x1, cmd_regs, AD9106_example3_regval, 66 );
+    ret = ret ? ret : host.write_sram( 0x1, 0, example1_RAM_gaussian, 512 );
+    ret = ret ? ret : host.start();
+    double change_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - t0 ).count();
+    double change_spi_ms = sim_cmd.time_ns() / 1e6;
+    
+    static uint16_t cmd_back[512];
+    AD910x_HostStatus cmd_st;
+    ret = ret ? ret : host.read_sram( 0x1, 0, cmd_back, 512 );
+    for ( int i=0; ret == 0 && i<512; i++ ) {
+        ret = ( cmd_back[i] != (uint16_t)( example1_RAM_gaussian[i] << 2 ) );
+    }
+    ret = ret ? ret : host.read_regs( 0x1, AD910X_REG_PAT_PERIOD, cmd_back, 1 );
+    ret = ret ? ret : ( cmd_back[0] != sim_cmd.dev[0].regs[AD910X_REG_PAT_PERIOD] );
+    ret = ret ? ret : host.status( 0x1, cmd_st );
+    
+    // * Readback during playback: READ_SRAM must leave RUN set * //
+    const uint16_t run_reg = AD910X_REG_PAT_STATUS, run_on = AD910X_PAT_RUN, run_off = 0x0000;
+    ret = ret ? ret : host.write_regs( 0x1, &run_reg, &run_on, 1 );
+    ret = ret ? ret : host.read_sram( 0x1, 0, cmd_back, 64 );
+    ret = ret ? ret : !( sim_cmd.dev[0].active[AD910X_REG_PAT_STATUS] & AD910X_PAT_RUN );
+    ret = ret ? ret : host.write_regs( 0x1, &run_reg, &run_off, 1 );
+    
+    // * Line noise before a command: the board resynchronizes on the next frame * //
+    const uint8_t noise[] = { 0xA5, 0xC3, 0x07, 0x01, 0xFF, 0x00, 0x12, 0xA5, 0x00 };
+    ret = ret ? ret : ( write( tty, noise, sizeof( noise ) ) != (ssize_t)sizeof( noise ) );
+    ret = ret ? ret : host.stop();
+    if ( ret != 0 || host.write_regs( 0x2, cmd_regs, AD9106_example3_regval, 1 ) != AD910X_STATUS_RANGE ) {
+        fprintf( stderr, "Command protocol failed: %d\n", ret );
+        return 1;
+    }
+    fprintf( stderr, "host protocol: ping %.3f ms, pattern change (66 regs, 512 samples, start) %.3f ms host + %.3f ms SPI, "
+            "%u commands, %u retries, SPI clock %u Hz\n",
+            ping_ms, change_ms, change_spi_ms, server.commands, host.retries, cmd_st.spi_hz );
+    
+    // * Streamed upload of a full waveform: two chunks buffered on the board * //
+    device_cmd.AD910x_invalidate_sram();
+    sim_cmd.reset_stats();
+    t0 = std::chrono::steady_clock::now();
+    ret = host.stream_sram( 0x1, 0, example2_4096_ramp, AD910X_SRAM_SIZE );
+    double stream_ms = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - t0 ).count();
+    for ( int i=0; ret == 0 && i<AD910X_SRAM_SIZE; i++ ) {
+        ret = ( sim_cmd.dev[0].sram[i] != (uint16_t)( example2_4096_ramp[i] << 2 ) );
+    }
+    if ( ret != 0 ) {
+        fprintf( stderr, "Streamed upload failed: %d\n", ret );
+        return 1;
+    }
+    // * STREAM_DATA frame of a chunk: 8 bytes framing, 2 index, 2 per sample; 10 bits per byte on the UART * //
+    uint32_t stream_bytes = ( AD910X_SRAM_SIZE / AD910X_STREAM_CHUNK ) * ( AD910X_CMD_OVERHEAD + 2 + 2 * AD910X_STREAM_CHUNK );
+    fprintf( stderr, "stream 4096 samples: %llu SPI frames, %u cs, %.3f ms host + %.3f ms SPI, %.0f ms at %d baud, "
+            "%u bytes of samples buffered on the board\n", (unsigned long long)sim_cmd.stats.frames, (unsigned)sim_cmd.stats.cs_toggles,
+            stream_ms, sim_cmd.time_ns() / 1e6, stream_bytes * 10e3 / 921600, 921600,
+            AD910X_STREAM_WINDOW * AD910X_STREAM_CHUNK * 2 );
+    close( tty );
+    board.join();
+    close( pty );
+    cmd_bus.stop();
+
+    // * 8 boards spread over 1, 2 and 4 SPI buses, one worker per bus * //
+    static AD910x_SIM *rig_sim[4];
+    static AD910x_ARRAY<8> *rig_dev[4];
+    for ( int b=0; b<4; b++ ) {
+        rig_sim[b] = new AD910x_SIM( 8 );
+        rig_dev[b] = new AD910x_ARRAY<8>( *rig_sim[b] );
+        rig_dev[b]->log_level = AD910X_LOG_OFF;
+        rig_dev[b]->spi_init( WORD_LEN, POL, FREQ );
+    }
+    for ( int buses=1; buses<=4; buses*=2 ) {
+        AD910x_BASE *drivers[4];
+        RigJob rig;
+        rig.boards_per_bus = 8 / buses;
+        for ( int b=0; b<buses; b++ ) {
+            drivers[b] = rig_dev[b];
+            rig.dev[b] = rig_dev[b];
+        }
+        AD910x_Parallel parallel( drivers, buses );
+        parallel.AD910x_reg_reset();
+        for ( int b=0; b<buses; b++ ) {
+            rig_sim[b]->reset_stats();
+        }
+        parallel.run( configure_bus, &rig );
+        parallel.AD910x_start_pattern();
+
+        double total_ms = 0, slowest_ms = 0;
+        for ( int b=0; b<buses; b++ ) {
+            double ms = rig_sim[b]->time_ns() / 1e6;
+            total_ms += ms;
+            slowest_ms = ( ms > slowest_ms ) ? ms : slowest_ms;
+            if ( rig_sim[b]->stats.access_errors != 0 ) {
+                fprintf( stderr, "Access errors on bus %d\n", b );
+                return 1;
+            }
+        }
+        // * Only bus 0 drives the shared trigger pin * //
+        if ( !rig_sim[0]->running() ) {
+            fprintf( stderr, "Shared trigger not asserted\n" );
+            return 1;
+        }
+        parallel.AD910x_stop_pattern();
+        fprintf( stderr, "8 boards on %d bus%s: serial %8.3f ms, parallel %8.3f ms\n",
+                buses, ( buses > 1 ) ? "es" : "", total_ms, slowest_ms );
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/******************************************************************************
+    @file:  ad910x_cmdemu.cpp
+
+    @brief: Host tool serving the AD910x command protocol (see ad910x_cmd.h)
+            on a pseudo terminal, backed by the simulator, so host software
+            can be tested without boards
+
+            Usage: ad910x_cmdemu [-v]
+            Prints the PTY path to stdout, then serves commands for 8
+            simulated boards on one SPI bus until interrupted. With -v every
+            command is logged with its modeled SPI time.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include "config.h"
+#include "ad910x.h"
+#include "ad910x_cmdserver.h"
+#include "ad910x_sim.h"
+
+static int pty_write( void *ctx, const uint8_t data[], uint32_t n ) {
+    return ( write( *(int *)ctx, data, n ) == (ssize_t)n ) ? 0 : -1;
+}
+
+int main( int argc, char *argv[] ) {
+    bool verbose = ( argc == 2 && strcmp( argv[1], "-v" ) == 0 );
+    
+    if ( argc > 2 || ( argc == 2 && !verbose ) ) {
+        fprintf( stderr, "Usage: %s [-v]\n", argv[0] );
+        return 2;
+    }
+    
+    int master = posix_openpt( O_RDWR | O_NOCTTY );
+    if ( master < 0 || grantpt( master ) != 0 || unlockpt( master ) != 0 ) {
+        perror( "posix_openpt" );
+        return 1;
+    }
+    
+    // * Raw mode on the terminal side, so frames pass unchanged * //
+    struct termios tio;
+    int slave = open( ptsname( master ), O_RDWR | O_NOCTTY );
+    if ( slave < 0 || tcgetattr( slave, &tio ) != 0 ) {
+        perror( ptsname( master ) );
+        return 1;
+    }
+    cfmakeraw( &tio );
+    tcsetattr( slave, TCSANOW, &tio );
+    printf( "%s\n", ptsname( master ) );
+    fflush( stdout );
+    
+    AD910x_SIM sim( 8 );
+    AD910x_ARRAY<8> device( sim );
+    device.log_level = AD910X_LOG_OFF;
+    device.spi_init( WORD_LEN, POL, FREQ );
+    device.AD910x_reg_reset();
+    device.AD910x_train_spi( TRAIN_FREQ );
+    AD910x_CmdServer server( device, pty_write, &master );
+    sim.reset_stats();
+    
+    uint8_t buf[4096];
+    ssize_t got = 1;
+    uint32_t done = 0;
+    struct pollfd pfd = { master, POLLIN, 0 };
+    while ( got > 0 ) {
+        if ( poll( &pfd, 1, AD910X_CMD_IDLE_MS ) == 0 ) {
+            server.idle();
+            continue;
+        }
+        got = read( master, buf, sizeof( buf ) );
+        for ( ssize_t i=0; i<got; i++ ) {
+            server.feed( buf[i] );
+            if ( verbose && server.commands + server.retries != done ) {
+                done = server.commands + server.retries;
+                fprintf( stderr, "command %u: %llu SPI frames, %.3f ms\n", done,
+                        (unsigned long long)sim.stats.frames, sim.time_ns() / 1e6 );
+                sim.reset_stats();
+            }
+        }
+    }
+    close( slave );
+    return 0;
+}
@@ -0,0 +1,182 @@
+/******************************************************************************
+    @file:  ad910x_dumpdecode.cpp
+
+    @brief: Host tool decoding a binary AD910x dump (see ad910x_dump.h) into
+            CSV and NumPy files
+
+            Usage: ad910x_dumpdecode [-b BAUD] INPUT PREFIX
+            INPUT is a capture file or the SDP-K1 serial port (e.g. /dev/ttyACM0),
+            which is set to BAUD (default 921600) raw mode. Reading stops at the
+            END frame. Writes PREFIX_regs.csv (dev,addr,value),
+            PREFIX_sram.csv (dev,addr,word,sample) and one PREFIX_sram_devN.npy
+            array of int16 samples per device.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include "ad910x_dump.h"
+#include "ad910x_regs.h"
+#include "ad910x_transport.h"
+
+//  * @brief Set a serial port to raw mode at a baud rate
+//  * @param fd - open serial port
+//  * @param baud - baud rate
+//  * @return 0 on success, -1 if the baud rate is not supported
+
+static int set_raw( int fd, long baud ) {
+    static const struct { long baud; speed_t speed; } rates[] = {
+        { 115200, B115200 }, { 230400, B230400 }, { 460800, B460800 }, { 921600, B921600 },
+        { 1000000, B1000000 }, { 1500000, B1500000 }, { 2000000, B2000000 }, { 3000000, B3000000 }
+    };
+    struct termios tio;
+    
+    for ( size_t i=0; i<sizeof( rates ) / sizeof( rates[0] ); i++ ) {
+        if ( rates[i].baud == baud && tcgetattr( fd, &tio ) == 0 ) {
+            cfmakeraw( &tio );
+            cfsetispeed( &tio, rates[i].speed );
+            cfsetospeed( &tio, rates[i].speed );
+            return tcsetattr( fd, TCSANOW, &tio );
+        }
+    }
+    return -1;
+}
+
+//  * @brief Write n int16 samples as a one-dimensional .npy array
+//  * @param path - output file
+//  * @param data[] - samples
+//  * @param n - number of samples
+//  * @return 0 on success
+
+static int write_npy( const char *path, const int16_t data[], uint32_t n ) {
+    char header[128];
+    int len = snprintf( header, sizeof( header ), "{'descr': '<i2', 'fortran_order': False, 'shape': (%u,), }", n );
+    
+    // * Magic, version 1.0 and header length take 10 bytes; pad the header to 64-byte alignment * //
+    while ( ( 10 + len + 1 ) % 64 != 0 ) {
+        header[len++] = ' ';
+    }
+    header[len++] = '\n';
+    
+    FILE *f = fopen( path, "wb" );
+    if ( f == NULL ) {
+        return -1;
+    }
+    uint8_t pre[10] = { 0x93, 'N', 'U', 'M', 'P', 'Y', 1, 0, (uint8_t)( len & 0xFF ), (uint8_t)( len >> 8 ) };
+    fwrite( pre, 1, sizeof( pre ), f );
+    fwrite( header, 1, len, f );
+    for ( uint32_t i=0; i<n; i++ ) {
+        uint8_t le[2] = { (uint8_t)( data[i] & 0xFF ), (uint8_t)( (uint16_t)data[i] >> 8 ) };
+        fwrite( le, 1, 2, f );
+    }
+    return fclose( f );
+}
+
+int main( int argc, char *argv[] ) {
+    static int16_t samples[AD910X_MAX_DEVS][AD910X_SRAM_SIZE];
+    static uint16_t sram_n[AD910X_MAX_DEVS];
+    AD910x_DumpDecoder dec;
+    long baud = 921600;
+    int arg = 1;
+    
+    if ( argc > 2 && strcmp( argv[1], "-b" ) == 0 ) {
+        baud = strtol( argv[2], NULL, 10 );
+        arg = 3;
+    }
+    if ( argc - arg != 2 ) {
+        fprintf( stderr, "Usage: %s [-b BAUD] INPUT PREFIX\n", argv[0] );
+        return 2;
+    }
+    
+    int fd = open( argv[arg], O_RDONLY | O_NOCTTY );
+    if ( fd < 0 ) {
+        perror( argv[arg] );
+        return 1;
+    }
+    if ( isatty( fd ) && set_raw( fd, baud ) != 0 ) {
+        fprintf( stderr, "Cannot set %s to %ld baud\n", argv[arg], baud );
+        return 1;
+    }
+    
+    char path[512];
+    snprintf( path, sizeof( path ), "%s_regs.csv", argv[arg + 1] );
+    FILE *regs = fopen( path, "w" );
+    snprintf( path, sizeof( path ), "%s_sram.csv", argv[arg + 1] );
+    FILE *sram = fopen( path, "w" );
+    if ( regs == NULL || sram == NULL ) {
+        perror( path );
+        return 1;
+    }
+    fprintf( regs, "dev,addr,value\n" );
+    fprintf( sram, "dev,addr,word,sample\n" );
+    
+    // * Decode until the END frame * //
+    uint8_t buf[4096];
+    ssize_t got;
+    uint32_t frames = 0;
+    int32_t expected = -1;
+    while ( expected < 0 && ( got = read( fd, buf, sizeof( buf ) ) ) > 0 ) {
+        for ( ssize_t i=0; i<got && expected < 0; i++ ) {
+            if ( !dec.feed( buf[i] ) ) {
+                continue;
+            }
+            if ( dec.type == AD910X_DUMP_END ) {
+                expected = dec.addr;
+                continue;
+            }
+            frames++;
+            for ( int j=0; j<dec.n; j++ ) {
+                uint16_t addr = dec.addr + j;
+                if ( dec.type == AD910X_DUMP_REGS ) {
+                    fprintf( regs, "%u,0x%04X,0x%04X\n", dec.dev, addr, dec.data[j] );
+                } else {
+                    int16_t sample = (int16_t)dec.data[j] >> 2;
+                    fprintf( sram, "%u,0x%04X,0x%04X,%d\n", dec.dev, addr, dec.data[j], sample );
+                    uint16_t pos = addr - AD910X_SRAM_ADDR;
+                    if ( dec.dev < AD910X_MAX_DEVS && pos < AD910X_SRAM_SIZE ) {
+                        samples[dec.dev][pos] = sample;
+                        sram_n[dec.dev] = ( pos + 1 > sram_n[dec.dev] ) ? pos + 1 : sram_n[dec.dev];
+                    }
+                }
+            }
+        }
+    }
+    close( fd );
+    fclose( regs );
+    fclose( sram );
+    
+    for ( int d=0; d<AD910X_MAX_DEVS; d++ ) {
+        if ( sram_n[d] != 0 ) {
+            snprintf( path, sizeof( path ), "%s_sram_dev%d.npy", argv[arg + 1], d );
+            if ( write_npy( path, samples[d], sram_n[d] ) != 0 ) {
+                perror( path );
+                return 1;
+            }
+        }
+    }
+    
+    fprintf( stderr, "%u frames decoded, %u CRC errors\n", frames, dec.crc_errors );
+    if ( expected < 0 ) {
+        fprintf( stderr, "Dump ended without END frame\n" );
+        return 1;
+    }
+    if ( (uint32_t)expected != frames ) {
+        fprintf( stderr, "%u of %d frames missing\n", expected - frames, expected );
+        return 1;
+    }
+    return 0;
+}
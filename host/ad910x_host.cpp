@@ -0,0 +1,358 @@
+/******************************************************************************
+    @file:  ad910x_host.cpp
+
+    @brief: Implements the Linux host library of the AD910x command protocol
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include "ad910x_host.h"
+
+AD910x_Host::AD910x_Host() : timeout_ms( 200 ), max_retries( 3 ), retries( 0 ), fd( -1 ), owned( false ), seq( 0 ), in_len( 0 ), in_pos( 0 ) {
+}
+
+AD910x_Host::~AD910x_Host() {
+    close();
+}
+
+//  * @brief Open a serial port in raw 8N1 mode
+//  * @param path - device, e.g. /dev/ttyACM0 or a PTY of ad910x_cmdemu
+//  * @param baud - baud rate, 115200 to 3000000
+//  * @return 0 on success, -1 on error
+
+int AD910x_Host::open( const char *path, long baud ) {
+    static const struct { long baud; speed_t speed; } rates[] = {
+        { 115200, B115200 }, { 230400, B230400 }, { 460800, B460800 }, { 921600, B921600 },
+        { 1000000, B1000000 }, { 1500000, B1500000 }, { 2000000, B2000000 }, { 3000000, B3000000 }
+    };
+    struct termios tio;
+    
+    close();
+    int f = ::open( path, O_RDWR | O_NOCTTY );
+    if ( f < 0 ) {
+        return -1;
+    }
+    for ( size_t i=0; i<sizeof( rates ) / sizeof( rates[0] ); i++ ) {
+        if ( rates[i].baud == baud && tcgetattr( f, &tio ) == 0 ) {
+            cfmakeraw( &tio );
+            cfsetispeed( &tio, rates[i].speed );
+            cfsetospeed( &tio, rates[i].speed );
+            if ( tcsetattr( f, TCSANOW, &tio ) == 0 ) {
+                tcflush( f, TCIOFLUSH );
+                fd = f;
+                owned = true;
+                return 0;
+            }
+        }
+    }
+    ::close( f );
+    return -1;
+}
+
+void AD910x_Host::attach( int f ) {
+    close();
+    fd = f;
+    owned = false;
+}
+
+void AD910x_Host::close() {
+    if ( owned && fd >= 0 ) {
+        ::close( fd );
+    }
+    fd = -1;
+    owned = false;
+    in_len = in_pos = 0;
+}
+
+//  * @brief Send one command frame with the next sequence number
+//  * @param cmd - AD910X_CMD_*
+//  * @param payload[] - command payload
+//  * @param len - payload size
+//  * @return sequence number used, or -1 on a write error
+
+int AD910x_Host::send( uint8_t cmd, const uint8_t payload[], uint16_t len ) {
+    uint8_t frame[AD910X_CMD_FRAME_MAX];
+    uint32_t size = AD910x_cmd_frame( frame, seq, cmd, payload, len );
+    
+    if ( fd < 0 || write( fd, frame, size ) != (ssize_t)size ) {
+        return -1;
+    }
+    return seq++;
+}
+
+//  * @brief Wait for a response to cmd; corrupt frames and other responses are skipped
+//  * @param cmd - AD910X_CMD_* of the command
+//  * @param want - sequence number to match, or -1 for any
+//  * @return true if rx holds the response, false on timeout or read error
+
+bool AD910x_Host::receive( uint8_t cmd, int want ) {
+    struct pollfd pfd = { fd, POLLIN, 0 };
+    
+    while ( true ) {
+        // * Bytes after a response stay in inbuf for the next call * //
+        while ( in_pos < in_len ) {
+            if ( rx.feed( inbuf[in_pos++] ) && rx.cmd == ( cmd | AD910X_CMD_REPLY ) && rx.len != 0 && ( want < 0 || rx.seq == want ) ) {
+                return true;
+            }
+        }
+        if ( poll( &pfd, 1, timeout_ms ) <= 0 ) {
+            return false;
+        }
+        ssize_t got = read( fd, inbuf, sizeof( inbuf ) );
+        if ( got <= 0 ) {
+            return false;
+        }
+        in_len = got;
+        in_pos = 0;
+    }
+}
+
+//  * @brief Send a command and wait for the response with the same sequence number.
+//  *        Stale or corrupt frames are skipped; on timeout or a BUSY answer the same
+//  *        frame is sent again.
+//  * @param cmd - AD910X_CMD_*
+//  * @param payload[] - command payload
+//  * @param len - payload size
+//  * @param reply[] - response payload output (AD910X_CMD_PAYLOAD bytes), may be NULL
+//  * @param reply_len - response payload size output, may be NULL
+//  * @return AD910X_STATUS_* of the response, or -1
+
+int AD910x_Host::transact( uint8_t cmd, const uint8_t payload[], uint16_t len, uint8_t reply[], uint16_t *reply_len ) {
+    int used = -1;
+    
+    for ( int attempt=0; attempt<=max_retries; attempt++ ) {
+        retries += ( attempt != 0 );
+        // * Retries reuse the sequence number, so the board does not run the command twice * //
+        seq = ( used < 0 ) ? seq : (uint8_t)used;
+        used = send( cmd, payload, len );
+        if ( used < 0 ) {
+            return -1;
+        }
+        if ( receive( cmd, used ) ) {
+            if ( rx.payload[0] == AD910X_STATUS_BUSY && attempt < max_retries ) {
+                continue;
+            }
+            if ( reply != NULL ) {
+                memcpy( reply, rx.payload, rx.len );
+            }
+            if ( reply_len != NULL ) {
+                *reply_len = rx.len;
+            }
+            return rx.payload[0];
+        }
+    }
+    return -1;
+}
+
+int AD910x_Host::ping() {
+    return transact( AD910X_CMD_PING, NULL, 0, NULL, NULL );
+}
+
+int AD910x_Host::start() {
+    return transact( AD910X_CMD_START, NULL, 0, NULL, NULL );
+}
+
+int AD910x_Host::stop() {
+    return transact( AD910X_CMD_STOP, NULL, 0, NULL, NULL );
+}
+
+//  * @brief Write registers; the board sends each batch with its register planner
+//  * @param mask - devices to write to
+//  * @param addr[] - n register addresses
+//  * @param data[] - n values
+//  * @param n - number of registers
+//  * @return 0, AD910X_STATUS_* or -1
+
+int AD910x_Host::write_regs( uint32_t mask, const uint16_t addr[], const uint16_t data[], uint16_t n ) {
+    uint8_t payload[AD910X_CMD_PAYLOAD];
+    
+    for ( uint16_t i=0; i<n; ) {
+        uint16_t k = ( n - i < AD910X_CMD_WORDS ) ? n - i : AD910X_CMD_WORDS;
+        AD910x_cmd_put32( payload, mask );
+        AD910x_cmd_put16( payload + 4, k );
+        for ( int j=0; j<k; j++ ) {
+            AD910x_cmd_put16( payload + 6 + 4 * j, addr[i + j] );
+            AD910x_cmd_put16( payload + 8 + 4 * j, data[i + j] );
+        }
+        int ret = transact( AD910X_CMD_WRITE_REGS, payload, 6 + 4 * k, NULL, NULL );
+        if ( ret != AD910X_STATUS_OK ) {
+            return ret;
+        }
+        i += k;
+    }
+    return 0;
+}
+
+//  * @brief Write SRAM samples, AD910X_CMD_WORDS per command
+//  * @param mask - devices to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param data[] - n samples
+//  * @param n - number of samples
+//  * @return 0, AD910X_STATUS_* or -1
+
+int AD910x_Host::write_sram( uint32_t mask, uint16_t offset, const int16_t data[], uint16_t n ) {
+    uint8_t payload[AD910X_CMD_PAYLOAD];
+    
+    for ( uint16_t i=0; i<n; ) {
+        uint16_t k = ( n - i < AD910X_CMD_WORDS ) ? n - i : AD910X_CMD_WORDS;
+        AD910x_cmd_put32( payload, mask );
+        AD910x_cmd_put16( payload + 4, offset + i );
+        AD910x_cmd_put16( payload + 6, k );
+        for ( int j=0; j<k; j++ ) {
+            AD910x_cmd_put16( payload + 8 + 2 * j, (uint16_t)data[i + j] );
+        }
+        int ret = transact( AD910X_CMD_WRITE_SRAM, payload, 8 + 2 * k, NULL, NULL );
+        if ( ret != AD910X_STATUS_OK ) {
+            return ret;
+        }
+        i += k;
+    }
+    return 0;
+}
+
+//  * @brief Read consecutive registers or SRAM words, AD910X_CMD_WORDS per command
+//  * @param cmd - AD910X_CMD_READ_REGS or AD910X_CMD_READ_SRAM
+//  * @param mask - device set; its lowest device is read
+//  * @param addr - first register or SRAM word
+//  * @param out[] - n words output
+//  * @param n - number of words
+//  * @return 0, AD910X_STATUS_* or -1
+
+int AD910x_Host::read_words( uint8_t cmd, uint32_t mask, uint16_t addr, uint16_t out[], uint16_t n ) {
+    uint8_t payload[8];
+    uint8_t reply[AD910X_CMD_PAYLOAD];
+    uint16_t len;
+    
+    for ( uint16_t i=0; i<n; ) {
+        uint16_t k = ( n - i < AD910X_CMD_WORDS ) ? n - i : AD910X_CMD_WORDS;
+        AD910x_cmd_put32( payload, mask );
+        AD910x_cmd_put16( payload + 4, addr + i );
+        AD910x_cmd_put16( payload + 6, k );
+        int ret = transact( cmd, payload, sizeof( payload ), reply, &len );
+        if ( ret != AD910X_STATUS_OK ) {
+            return ret;
+        }
+        if ( len != 1 + 2 * k ) {
+            return -1;
+        }
+        for ( int j=0; j<k; j++ ) {
+            out[i + j] = AD910x_cmd_get16( reply + 1 + 2 * j );
+        }
+        i += k;
+    }
+    return 0;
+}
+
+int AD910x_Host::read_regs( uint32_t mask, uint16_t addr, uint16_t out[], uint16_t n ) {
+    return read_words( AD910X_CMD_READ_REGS, mask, addr, out, n );
+}
+
+int AD910x_Host::read_sram( uint32_t mask, uint16_t offset, uint16_t out[], uint16_t n ) {
+    return read_words( AD910X_CMD_READ_SRAM, mask, offset, out, n );
+}
+
+//  * @brief Read the pattern and link state of a board
+//  * @param mask - device set; its lowest device is read
+//  * @param st - status output
+//  * @return 0, AD910X_STATUS_* or -1
+
+int AD910x_Host::status( uint32_t mask, AD910x_HostStatus &st ) {
+    uint8_t payload[4];
+    uint8_t reply[AD910X_CMD_PAYLOAD];
+    uint16_t len;
+    
+    AD910x_cmd_put32( payload, mask );
+    int ret = transact( AD910X_CMD_STATUS, payload, sizeof( payload ), reply, &len );
+    if ( ret != AD910X_STATUS_OK ) {
+        return ret;
+    }
+    if ( len != 17 ) {
+        return -1;
+    }
+    st.pat_status = AD910x_cmd_get16( reply + 1 );
+    st.cfg_error = AD910x_cmd_get16( reply + 3 );
+    st.spi_hz = AD910x_cmd_get32( reply + 5 );
+    st.link_errors = AD910x_cmd_get32( reply + 9 );
+    st.mismatches = AD910x_cmd_get32( reply + 13 );
+    return 0;
+}
+
+//  * @brief Stream samples into SRAM in AD910X_STREAM_CHUNK pieces, keeping up
+//  *        to the board's window of chunks in flight. Lost chunks are resent
+//  *        from the first one the board has not acknowledged.
+//  * @param mask - devices to write to
+//  * @param offset - first SRAM word (0 = 0x6000)
+//  * @param data[] - n samples
+//  * @param n - number of samples
+//  * @return 0, AD910X_STATUS_* or -1
+
+int AD910x_Host::stream_sram( uint32_t mask, uint16_t offset, const int16_t data[], uint16_t n ) {
+    uint8_t payload[AD910X_CMD_PAYLOAD];
+    uint8_t reply[AD910X_CMD_PAYLOAD];
+    uint16_t len;
+    
+    AD910x_cmd_put32( payload, mask );
+    AD910x_cmd_put16( payload + 4, offset );
+    AD910x_cmd_put16( payload + 6, n );
+    int ret = transact( AD910X_CMD_STREAM_BEGIN, payload, 8, reply, &len );
+    if ( ret != AD910X_STATUS_OK || len != 4 ) {
+        return ( ret != AD910X_STATUS_OK ) ? ret : -1;
+    }
+    uint8_t window = reply[1];
+    uint16_t chunk = AD910x_cmd_get16( reply + 2 );
+    chunk = ( chunk > AD910X_STREAM_CHUNK || chunk == 0 ) ? AD910X_STREAM_CHUNK : chunk;
+    uint16_t chunks = ( n + chunk - 1 ) / chunk;
+    uint16_t sent = 0;
+    uint16_t acked = 0;
+    int fails = 0;
+    
+    while ( acked < chunks ) {
+        for ( ; sent < chunks && sent - acked < window; sent++ ) {
+            uint16_t k = ( n - sent * chunk < chunk ) ? n - sent * chunk : chunk;
+            AD910x_cmd_put16( payload, sent );
+            for ( int j=0; j<k; j++ ) {
+                AD910x_cmd_put16( payload + 2 + 2 * j, (uint16_t)data[sent * chunk + j] );
+            }
+            if ( send( AD910X_CMD_STREAM_DATA, payload, 2 + 2 * k ) < 0 ) {
+                return -1;
+            }
+        }
+        if ( !receive( AD910X_CMD_STREAM_DATA, -1 ) || rx.len != 3 ) {
+            if ( ++fails > max_retries ) {
+                return -1;
+            }
+            retries++;
+            sent = acked;
+            continue;
+        }
+        uint16_t next = AD910x_cmd_get16( rx.payload + 1 );
+        if ( rx.payload[0] == AD910X_STATUS_ORDER ) {
+            acked = sent = next;
+        } else if ( rx.payload[0] != AD910X_STATUS_OK ) {
+            return rx.payload[0];
+        } else if ( (int16_t)( next - acked ) > 0 ) {
+            acked = next;
+            fails = 0;
+        }
+    }
+    
+    ret = transact( AD910X_CMD_STREAM_END, NULL, 0, reply, &len );
+    if ( ret == AD910X_STATUS_OK && ( len != 3 || AD910x_cmd_get16( reply + 1 ) != n ) ) {
+        return -1;
+    }
+    return ret;
+}
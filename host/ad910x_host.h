@@ -0,0 +1,96 @@
+/******************************************************************************
+    @file:  ad910x_host.h
+
+    @brief: Defines the Linux host library of the AD910x command protocol
+            (see ad910x_cmd.h)
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+
+#ifndef __ad910x_host_h__
+#define __ad910x_host_h__
+#include <stdint.h>
+#include "ad910x_cmd.h"
+
+/*** Reply of AD910X_CMD_STATUS ***/
+struct AD910x_HostStatus {
+    uint16_t pat_status;        // PAT_STATUS of the lowest device in the mask
+    uint16_t cfg_error;         // CFG_ERROR of the same device
+    uint32_t spi_hz;            // Trained SPI clock, 0 if not trained
+    uint32_t link_errors;       // Failed SPI link tests
+    uint32_t mismatches;        // Mismatches of the last readback verification
+};
+
+/*** Client of one SDP-K1 running AD910x_CmdServer. Every call returns 0 on
+     success, an AD910X_STATUS_* code if the board rejected the command, or
+     -1 if no valid response arrived after max_retries retries. ***/
+class AD910x_Host {
+    public:
+        AD910x_Host();
+        ~AD910x_Host();
+
+        // Open a serial port (or PTY) in raw mode at a baud rate
+        int open( const char *path, long baud );
+
+        // Use an already open, raw file descriptor; it is not closed by the library
+        void attach( int fd );
+
+        void close();
+
+        int ping();
+        int start();
+        int stop();
+
+        // Write n registers to the devices in mask with one transaction per AD910X_CMD_WORDS registers
+        int write_regs( uint32_t mask, const uint16_t addr[], const uint16_t data[], uint16_t n );
+
+        // Read n consecutive registers of the lowest device in mask
+        int read_regs( uint32_t mask, uint16_t addr, uint16_t out[], uint16_t n );
+
+        // Write n samples to SRAM of the devices in mask, starting at offset (0 = 0x6000)
+        int write_sram( uint32_t mask, uint16_t offset, const int16_t data[], uint16_t n );
+
+        // Read n SRAM words in wire format of the lowest device in mask
+        int read_sram( uint32_t mask, uint16_t offset, uint16_t out[], uint16_t n );
+
+        int status( uint32_t mask, AD910x_HostStatus &st );
+
+        // Stream n samples into SRAM of the devices in mask with flow control; the board buffers two chunks
+        int stream_sram( uint32_t mask, uint16_t offset, const int16_t data[], uint16_t n );
+
+        uint32_t timeout_ms;        // Wait for a response before retrying
+        uint8_t max_retries;        // Retries of one command
+        uint32_t retries;           // Retries sent, cleared by the user
+
+    private:
+        // Send one frame; returns its sequence number or -1
+        int send( uint8_t cmd, const uint8_t payload[], uint16_t len );
+
+        // Wait for a response to cmd with sequence number want (-1 = any) in rx
+        bool receive( uint8_t cmd, int want );
+
+        // Send a command and wait for its response; returns the response status or -1
+        int transact( uint8_t cmd, const uint8_t payload[], uint16_t len, uint8_t reply[], uint16_t *reply_len );
+
+        // Read n consecutive registers or SRAM words with AD910X_CMD_READ_REGS/READ_SRAM
+        int read_words( uint8_t cmd, uint32_t mask, uint16_t addr, uint16_t out[], uint16_t n );
+
+        int fd;
+        bool owned;                 // fd was opened by open()
+        uint8_t seq;
+        AD910x_CmdParser rx;
+        uint8_t inbuf[512];         // Received bytes not parsed yet
+        int in_len;
+        int in_pos;
+};
+#endif
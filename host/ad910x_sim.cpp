@@ -0,0 +1,251 @@
+/******************************************************************************
+    @file:  ad910x_sim.cpp
+ 
+    @brief: Implements the host-side AD910x register/SRAM simulator
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+#include <string.h>
+#include "ad910x_sim.h"
+
+AD910x_SIM::AD910x_SIM( uint8_t num_devs ) :
+        ref_clk_hz( 100000000 ), frame_gap_ns( 1000 ), block_gap_ns( 100 ), cs_ns( 200 ), link_max_hz( 0 ),
+        dev( num_devs ), bits( 16 ), sclk_hz( 781250 ), selected( 0 ), trigger_low( false ), noise( 1 ) {
+    for ( size_t i=0; i<dev.size(); i++ ) {
+        power_on_reset( dev[i] );
+        memset( dev[i].sram, 0, sizeof( dev[i].sram ) );
+    }
+    reset_stats();
+}
+
+//  * @brief Load register values after reset
+//  * @param d - device to reset
+//  * @return none
+
+void AD910x_SIM::power_on_reset( Device &d ) {
+    memset( d.regs, 0, sizeof( d.regs ) );
+    for ( size_t i=0; i<sizeof( AD910X_REG_DEFAULTS )/sizeof( AD910X_REG_DEFAULTS[0] ); i++ ) {
+        d.regs[AD910X_REG_DEFAULTS[i].addr] = AD910X_REG_DEFAULTS[i].val;
+    }
+    memcpy( d.active, d.regs, sizeof( d.active ) );
+    d.instr_next = true;
+    d.read = false;
+    d.addr = 0;
+}
+
+void AD910x_SIM::reset_stats() {
+    memset( &stats, 0, sizeof( stats ) );
+}
+
+void AD910x_SIM::format( uint8_t reg_len, uint8_t ) {
+    bits = reg_len;
+}
+
+//  * @brief Model SPI prescaler: highest ref_clk_hz / 2^n (n = 1..8) not above hz
+//  * @param hz - requested SPI bus frequency
+//  * @return none
+
+void AD910x_SIM::frequency( uint32_t hz ) {
+    uint32_t div = 2;
+    while ( div < 256 && ref_clk_hz / div > hz ) {
+        div <<= 1;
+    }
+    sclk_hz = ref_clk_hz / div;
+}
+
+void AD910x_SIM::select( uint32_t dev_mask ) {
+    selected = dev_mask;
+    for ( size_t i=0; i<dev.size(); i++ ) {
+        if ( dev_mask & ( 1u << i ) ) {
+            dev[i].instr_next = true;
+        }
+    }
+    stats.cs_toggles++;
+    elapse( stats.overhead_ns, cs_ns );
+}
+
+void AD910x_SIM::deselect() {
+    selected = 0;
+}
+
+uint16_t AD910x_SIM::write( uint16_t frame ) {
+    return shift( frame, frame_gap_ns );
+}
+
+void AD910x_SIM::write_block( const uint16_t frames[], uint32_t n ) {
+    for ( uint32_t i=0; i<n; i++ ) {
+        shift( frames[i], block_gap_ns );
+    }
+}
+
+//  * @brief Shift one frame into every selected device
+//  * @param frame - frame on MOSI
+//  * @param gap_ns - software overhead before the next frame
+//  * @return frame on MISO (wired-OR of the selected devices)
+
+uint16_t AD910x_SIM::shift( uint16_t frame, uint32_t gap_ns ) {
+    uint16_t miso = 0;
+
+    frame = bit_errors( frame );
+
+    for ( size_t i=0; i<dev.size(); i++ ) {
+        if ( selected & ( 1u << i ) ) {
+            miso |= access( dev[i], frame );
+        }
+    }
+
+    stats.frames++;
+    elapse( stats.wire_ns, (uint64_t)bits * 1000000000ull / sclk_hz );
+    elapse( stats.overhead_ns, gap_ns );
+
+    return bit_errors( miso );
+}
+
+//  * @brief Model signal integrity of the wiring: frames are clean up to 75% of
+//  *        link_max_hz, then the chance of one flipped bit per frame rises
+//  *        linearly to 100% at 125% of link_max_hz
+//  * @param frame - frame on the wire
+//  * @return frame as received
+
+uint16_t AD910x_SIM::bit_errors( uint16_t frame ) {
+    if ( link_max_hz == 0 || sclk_hz <= link_max_hz / 4 * 3 ) {
+        return frame;
+    }
+
+    noise = noise * 1103515245u + 12345u;
+    uint32_t chance = (uint32_t)( (uint64_t)( sclk_hz - link_max_hz / 4 * 3 ) * 1000 / ( link_max_hz / 2 ) );
+    if ( ( noise >> 8 ) % 1000 < chance ) {
+        frame ^= 1u << ( ( noise >> 20 ) % 16 );
+    }
+    return frame;
+}
+
+//  * @brief Decode one frame of a (possibly multi-word) transaction
+//  * @param d - selected device
+//  * @param frame - frame on MOSI
+//  * @return data driven on MISO
+
+uint16_t AD910x_SIM::access( Device &d, uint16_t frame ) {
+    if ( d.instr_next ) {
+        d.instr_next = false;
+        d.read = ( frame & AD910X_SPI_READ ) != 0;
+        d.addr = frame & AD910X_SPI_ADDR_MASK;
+        return 0;
+    }
+
+    uint16_t addr = d.addr++;
+    uint16_t status = d.regs[AD910X_REG_PAT_STATUS];
+    uint16_t miso = 0;
+
+    if ( addr >= AD910X_SRAM_ADDR && addr < AD910X_SRAM_ADDR + AD910X_SRAM_SIZE ) {
+        if ( d.read ) {
+            if ( ( status & ( AD910X_MEM_ACCESS | AD910X_BUF_READ ) ) == ( AD910X_MEM_ACCESS | AD910X_BUF_READ ) ) {
+                miso = d.sram[addr - AD910X_SRAM_ADDR];
+            } else {
+                stats.access_errors++;
+            }
+        } else if ( ( status & AD910X_MEM_ACCESS ) && !( status & AD910X_BUF_READ ) ) {
+            d.sram[addr - AD910X_SRAM_ADDR] = frame & 0xFFFC;
+            stats.sram_writes++;
+            if ( trigger_low && playing( d, addr - AD910X_SRAM_ADDR ) ) {
+                stats.live_sram_writes++;
+            }
+        } else {
+            stats.access_errors++;
+        }
+    } else if ( addr < AD910X_REG_SPACE ) {
+        if ( d.read ) {
+            miso = d.regs[addr];
+        } else {
+            // * RAMUPDATE latches the written registers and self-clears; PAT_STATUS acts at once * //
+            if ( addr == AD910X_REG_RAMUPDATE ) {
+                if ( frame & 0x0001 ) {
+                    memcpy( d.active, d.regs, sizeof( d.active ) );
+                }
+                frame = 0;
+            }
+            d.regs[addr] = frame;
+            if ( addr == AD910X_REG_PAT_STATUS ) {
+                d.active[addr] = frame;
+            }
+            stats.reg_writes++;
+        }
+    }
+
+    return miso;
+}
+
+void AD910x_SIM::delay_us( uint32_t us ) {
+    elapse( stats.delay_ns, (uint64_t)us * 1000 );
+}
+
+//  * @brief Advance modeled time and account it as downtime while the pattern
+//  *        is stopped or cannot read its SRAM
+//  * @param counter - time counter of the activity
+//  * @param ns - duration
+//  * @return none
+
+void AD910x_SIM::elapse( uint64_t &counter, uint64_t ns ) {
+    counter += ns;
+    if ( !trigger_low || sram_detached() ) {
+        stats.stopped_ns += ns;
+    }
+}
+
+//  * @brief Check whether SPI owns the SRAM of a device. MEM_ACCESS hands the
+//  *        SRAM to SPI and takes it from the pattern generator, so playback
+//  *        pauses while it is set, whatever RUN and the trigger pin say.
+//  * @param none
+//  * @return true if MEM_ACCESS is set on any device
+
+bool AD910x_SIM::sram_detached() const {
+    for ( size_t i=0; i<dev.size(); i++ ) {
+        if ( dev[i].active[AD910X_REG_PAT_STATUS] & AD910X_MEM_ACCESS ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//  * @brief Check whether an SRAM word lies in START_ADDRx..STOP_ADDRx of a
+//  *        channel, taken from the registers in effect
+//  * @param d - device
+//  * @param pos - SRAM word (0 = 0x6000)
+//  * @return true if the running pattern reads the word
+
+bool AD910x_SIM::playing( const Device &d, uint16_t pos ) const {
+    for ( int ch=0; ch<AD910X_CHANNELS; ch++ ) {
+        uint16_t start = d.active[AD910X_REG_START_ADDR( ch )] >> AD910X_SRAM_ADDR_SHIFT;
+        uint16_t stop = d.active[AD910X_REG_STOP_ADDR( ch )] >> AD910X_SRAM_ADDR_SHIFT;
+        if ( stop > start && pos >= start && pos <= stop ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//  * @brief Model reset pin: registers return to defaults while held low
+//  * @param level - pin level
+//  * @return none
+
+void AD910x_SIM::set_reset( int level ) {
+    if ( level == 0 ) {
+        for ( size_t i=0; i<dev.size(); i++ ) {
+            power_on_reset( dev[i] );
+        }
+    }
+}
+
+void AD910x_SIM::set_trigger( int level ) {
+    trigger_low = ( level == 0 );
+}
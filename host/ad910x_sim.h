@@ -0,0 +1,104 @@
+/******************************************************************************
+    @file:  ad910x_sim.h
+ 
+    @brief: Defines a host-side AD910x simulator implementing the SPI
+            transport, for profiling the driver without an SDP-K1
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+******************************************************************************/
+
+#ifndef __ad910x_sim_h__
+#define __ad910x_sim_h__
+#include <stdint.h>
+#include <vector>
+#include "ad910x_regs.h"
+#include "ad910x_transport.h"
+
+class AD910x_SIM : public AD910x_Transport {
+    public:
+        /*** Modeled state of one AD910x ***/
+        struct Device {
+            uint16_t regs[AD910X_REG_SPACE];    // 16-bit SPI register file, as written
+            uint16_t active[AD910X_REG_SPACE];  // Registers in effect, latched from regs by RAMUPDATE
+            uint16_t sram[AD910X_SRAM_SIZE];    // Pattern SRAM at 0x6000
+            bool instr_next;                    // Next frame is an instruction word
+            bool read;                          // Current transaction is a read
+            uint16_t addr;                      // Current (auto-incremented) address
+        };
+
+        /*** Bus statistics ***/
+        struct Stats {
+            uint64_t frames;            // SPI frames shifted
+            uint64_t cs_toggles;        // Chip-select assertions
+            uint64_t wire_ns;           // Time spent clocking frames
+            uint64_t overhead_ns;       // Chip-select and inter-frame overhead
+            uint64_t delay_ns;          // Time spent in delay_us
+            uint64_t sram_writes;       // SRAM words written
+            uint64_t reg_writes;        // Register words written
+            uint64_t access_errors;     // SRAM accesses rejected by PAT_STATUS
+            uint64_t live_sram_writes;  // SRAM words written inside the range a running pattern plays
+            uint64_t stopped_ns;        // Modeled time with no output: trigger pin high, or MEM_ACCESS set on any device
+        };
+
+        /*** Timing model ***/
+        uint32_t ref_clk_hz;            // SPI peripheral reference clock
+        uint32_t frame_gap_ns;          // Software overhead of a blocking frame
+        uint32_t block_gap_ns;          // Overhead between frames of a block transfer
+        uint32_t cs_ns;                 // Overhead of one chip-select cycle
+        uint32_t link_max_hz;           // Fastest clean SPI clock of the wiring, 0 = no bit errors
+
+        std::vector<Device> dev;
+        Stats stats;
+
+        AD910x_SIM( uint8_t num_devs = 1 );
+
+        void format( uint8_t reg_len, uint8_t mode );
+        void frequency( uint32_t hz );
+        uint32_t get_frequency() { return sclk_hz; }
+        void select( uint32_t dev_mask );
+        void deselect();
+        uint16_t write( uint16_t frame );
+        void write_block( const uint16_t frames[], uint32_t n );
+        void delay_us( uint32_t us );
+        uint32_t time_us() { return (uint32_t)( time_ns() / 1000 ); }
+        void set_reset( int level );
+        void set_trigger( int level );
+
+        // Actual SPI clock after prescaler selection
+        uint32_t spi_hz() const { return sclk_hz; }
+
+        // Whether the trigger pin is low (pattern running)
+        bool running() const { return trigger_low; }
+
+        // Total modeled bus time
+        uint64_t time_ns() const { return stats.wire_ns + stats.overhead_ns + stats.delay_ns; }
+
+        // Clear bus statistics
+        void reset_stats();
+
+    private:
+        uint8_t bits;
+        uint32_t sclk_hz;
+        uint32_t selected;
+        bool trigger_low;
+        uint32_t noise;                 // State of the bit error generator
+
+        void power_on_reset( Device &d );
+        void elapse( uint64_t &counter, uint64_t ns );
+        bool sram_detached() const;
+        bool playing( const Device &d, uint16_t pos ) const;
+        uint16_t shift( uint16_t frame, uint32_t gap_ns );
+        uint16_t access( Device &d, uint16_t frame );
+        uint16_t bit_errors( uint16_t frame );
+};
+#endif
@@ -0,0 +1,85 @@
+/******************************************************************************
+    @file:  ad910x_wavepack.cpp
+
+    @brief: Host tool packing AD910x SRAM samples into a C initializer of an
+            AD910x_PackedWave (see ad910x_wave.h)
+
+            Usage: ad910x_wavepack NAME [FILE]
+            Reads up to 4096 integer samples separated by whitespace or commas
+            from FILE or stdin and writes the initializer to stdout.
+-------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License.
+******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "ad910x_regs.h"
+#include "ad910x_wave.h"
+
+int main( int argc, char *argv[] ) {
+    static int16_t samples[AD910X_SRAM_SIZE];
+    static uint8_t packed[AD910X_SRAM_SIZE * 2];
+    uint16_t n = 0;
+
+    if ( argc < 2 || argc > 3 ) {
+        fprintf( stderr, "Usage: %s NAME [FILE]\n", argv[0] );
+        return 2;
+    }
+
+    FILE *in = ( argc == 3 ) ? fopen( argv[2], "r" ) : stdin;
+    if ( in == NULL ) {
+        perror( argv[2] );
+        return 1;
+    }
+
+    // * Read integers, skipping separators * //
+    int c;
+    while ( ( c = fgetc( in ) ) != EOF ) {
+        if ( c != '-' && ( c < '0' || c > '9' ) ) {
+            continue;
+        }
+        ungetc( c, in );
+        long v;
+        if ( fscanf( in, "%ld", &v ) != 1 ) {
+            fgetc( in );
+            continue;
+        }
+        if ( n == AD910X_SRAM_SIZE ) {
+            fprintf( stderr, "More than %d samples\n", AD910X_SRAM_SIZE );
+            return 1;
+        }
+        if ( v < AD910X_WAVE_MIN || v > AD910X_WAVE_MAX ) {
+            fprintf( stderr, "Sample %u out of range: %ld\n", n, v );
+            return 1;
+        }
+        samples[n++] = (int16_t)v;
+    }
+    if ( in != stdin ) {
+        fclose( in );
+    }
+
+    uint32_t size = AD910x_pack_wave( samples, n, packed, sizeof( packed ) );
+    if ( n != 0 && size == 0 ) {
+        fprintf( stderr, "Packing failed\n" );
+        return 1;
+    }
+
+    printf( "// %u samples packed into %u bytes\n", n, size );
+    printf( "static const uint8_t %s_data[%u] = {", argv[1], size ? size : 1 );
+    for ( uint32_t i=0; i<size; i++ ) {
+        printf( "%s0x%02X%s", ( i % 12 ) ? " " : "\n    ", packed[i], ( i + 1 < size ) ? "," : "" );
+    }
+    printf( "%s};\n", size ? "\n" : "0" );
+    printf( "static const AD910x_PackedWave %s = { %u, %u, %s_data };\n", argv[1], n, size, argv[1] );
+    fprintf( stderr, "%u samples, %u bytes (%.1f%% of %u)\n", n, size, n ? 100.0 * size / ( 2 * n ) : 0.0, 2 * n );
+    return 0;
+}
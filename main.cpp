@@ -1,536 +1,681 @@
-/*******************************************************************************
-    @file:   main.cpp
-    
-    @brief:  Main module for EVAL-AD910x application interface
---------------------------------------------------------------------------------
-    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
-    This software is proprietary to Analog Devices, Inc. and its licensors.
-
-    Licensed under the Apache License, Version 2.0 (the "License");
-    you may not use this file except in compliance with the License.
-
-    Unless required by applicable law or agreed to in writing, software
-    distributed under the License is distributed on an "AS IS" BASIS,
-    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-    See the License for the specific language governing permissions and
-    limitations under the License. 
-*******************************************************************************/
-
-/*******************************************************************************
-    About AD910x
-        * Product Page: https://www.analog.com/AD9102, https://www.analog.com/AD9106
-        * Eval Page:    https://www.analog.com/eval-ad9102, https://www.analog.com/eval-ad9106
-        * Wiki Guide:   https://wiki.analog.com/resources/eval/dpg/eval-ad9106-mbed
-
-    User Instructions
-        * To use the code for single-board evaluation: Uncomment Line 90
-        * To use the code for multi-board evaluation: Uncomment Line 91
-*******************************************************************************/
-
-// *** Libraries *** //
-#include "mbed.h"
-#include "platform/mbed_thread.h"
-#include "config.h"
-#include "ad910x.h"
-
-// *** Defines for UART Protocol *** //
-#define BAUD_RATE       115200
-
-AD910x_SINGLE device_single;                        // Board variable definition for single-board use case (see ad910x.h)          
-AD910x_MULTI device_multi;                          // Board variable definition for multi-board use case (see ad910x.h)
-
-DigitalOut en_cvddx( PG_7, 0 );                     // DigitalOut instance for enable pin of on-board oscillator supply
-DigitalOut shdn_n_lt3472( PG_9, 0 );                // DigitalOut instance for shutdown/enable pin of on-board amplifier supply
-
-// * Configure and instantiate UART protocol and baud rate * //
-UnbufferedSerial pc( USBTX, USBRX, BAUD_RATE );
-
-#pragma region: Function Declarations
-/*** Single-Board ***/
-void main_single( void );
-void setup_device_single( void );
-void print_menu_single( void );
-void print_prompt1_single( void );
-void print_prompt2_single( void );
-void print_title_single( void );
-void sel_example_single( char example );
-void prog_example1_single( void );
-void prog_example2_single( void );
-void prog_example3_single( void );
-void prog_example4_single( void );
-void prog_example5_single( void );
-void prog_example6_single( void );
-void stop_example_single( void );
-
-/*** Multi-Board ***/
-void main_multi( void );
-void setup_device_multi( void );
-void print_menu_multi( void );
-void print_menu_ext( void );
-void print_prompt1_multi( void );
-void print_prompt2_multi( void );
-void print_prompt2_ext( void );
-void print_title_multi( void );	
-void sel_example_multi( bool dev_num, char example );	
-void prog_example1_multi( bool dev_num );	
-void prog_example2_multi( bool dev_num );	
-void prog_example3_multi( bool dev_num );	
-void prog_example4_multi( bool dev_num );	
-void prog_example5_multi( bool dev_num );	
-void prog_example6_multi( bool dev_num );
-void stop_example_multi( void );
-
-/*** Common Functions ***/
-void print_prompt3( void );
-void print_prompt4( void );
-#pragma endregion
-
-// *** Main Functions *** //
-int main() {
-    //main_single();
-    //main_multi();
-    return 0;
-}
-
-#pragma region (Function Definitions)
-#pragma region: Main Functions
-void main_single(){
-    char ext_clk = 'y';
-    char amp_out = 'n';
-    char stop = 'n';
-    char exit = 'n';
-    char example = 1;
-    uint8_t connected = 1;
-    
-    device_single.resetb = 1;
-    device_single.triggerb = 1;
-    
-    setup_device_single();
-    print_title_single();
-    
-    // * Configure Board Settings * //
-    print_prompt1_single();
-    while( pc.readable() == 0 );
-    ext_clk = getchar();
-    if ( ext_clk == 'y' ) {
-        en_cvddx = 0;
-        printf("\nPlease connect external clock source to J10.\n");
-    } else {
-        en_cvddx = 1;
-        printf("\nOn-board oscillator supply is enabled.\n");
-    }
-    thread_sleep_for(500);
-    print_prompt2_single();
-    while( pc.readable() == 0 );
-    amp_out = getchar();
-    if ( amp_out == 'y' ) {
-        shdn_n_lt3472 = 1;
-        printf("\nOn-board amplifier supply is enabled.\n");
-    } else {
-        shdn_n_lt3472 = 0;
-    }
-    
-    // * selecting Waveform Pattern * //
-    while( connected == 1 ) {
-        print_menu_single();
-        while( pc.readable() == 0 );
-        example = getchar();
-        sel_example_single( example );
-        
-        print_prompt3();
-        while( pc.readable() == 0 );
-        stop = getchar();		
-        if ( stop == 'y' ) {	
-            stop_example_single();	
-            stop = 'n';	
-        } else {	
-            stop_example_single();
-            connected = 0;	
-            print_prompt4();		
-        }	
-    }
-}
-void main_multi(){
-    char amp_out = 'n';	
-    char stop = 'n';	
-    char exit = 'n';	
-    char example_b1 = 3;	
-    char example_b2 = 3;	
-    uint8_t connected = 1;
-    bool device2;
-    	
-    device_multi.resetb = 1;	
-    device_multi.triggerb = 1;
-    
-    setup_device_multi();	
-    print_title_multi();	
-
-    // * Configure Board Settings * //
-    print_prompt1_multi();		
-    print_prompt2_multi();	
-    while( pc.readable() == 0 );	
-    amp_out = getchar();		
-    if ( amp_out == 'y' ) {	
-        shdn_n_lt3472 = 1;	
-        print_prompt2_ext();	
-    } else {	
-        shdn_n_lt3472 = 0;	
-    }
-    // * selecting Waveform Pattern * //
-    while( connected == 1 ) {
-        device2 = false;                            // Board 1 selection
-        print_menu_multi();	
-        while( pc.readable() == 0 );
-        example_b1 = getchar();
-        sel_example_multi( device2, example_b1 );
-        
-        device2 = true;                             // Board 2 selection
-        print_menu_ext();
-        while( pc.readable() == 0 );		
-        example_b2 = getchar();	
-        sel_example_multi( device2, example_b2 );
-        print_prompt3();	
-        while( pc.readable() == 0 );
-        stop = getchar();		
-        if ( stop == 'y' ) {	
-            stop_example_multi();	
-            stop = 'n';	
-        } else {	
-            stop_example_multi();
-            connected = 0;	
-            print_prompt4();		
-        }	
-    }
-}
-#pragma endregion
-#pragma region: Functions to set up SPI communication
-void setup_device_single() {
-    device_single.spi_init( WORD_LEN, POL, FREQ );
-    device_single.AD910x_reg_reset();
-}
-void setup_device_multi() {
-    device_multi.spi_init( WORD_LEN, POL, FREQ );
-    device_multi.AD910x_reg_reset();
-}
-#pragma endregion
-#pragma region: Functions to print the title block when program first starts
-void print_title_single() {
-    printf("\n***********************************************************************\n");
-    printf("* EVAL-%s Demonstration Program                                   *\n", ACTIVE_DEVICE);
-    printf("*                                                                     *\n");
-    printf("* This program demonstrates how to generate waveforms with the %s *\n", ACTIVE_DEVICE);
-    printf("* using example register configurations in the datasheet.             *\n");
-    printf("* This program is developed on Mbed OS version 6.                     *\n");
-    printf("***********************************************************************\n");   
-}
-void print_title_multi() {	
-    printf("\n***********************************************************************\n");	
-    printf("* EVAL-%s Demonstration Program                                   *\n", ACTIVE_DEVICE);	
-    printf("*                                                                     *\n");	
-    printf("* This program demonstrates multi-chip synchronization using two %ss *\n", ACTIVE_DEVICE);	
-    printf("* using example register configurations in the datasheet.             *\n");	
-    printf("* This program is developed on Mbed OS version 6.                     *\n");	
-    printf("***********************************************************************\n");   	
-}
-#pragma endregion
-#pragma region: Functions to print the first prompt/question on whether to set up the on-board oscillator/s
-void print_prompt1_single() {
-    printf( "\nUsing external clock source?\n" );
-    printf( "If yes, press y. If no, press any other key.\n" );
-}
-void print_prompt1_multi() {
-    printf( "\nPlease connect clock inputs of both evaluation boards to a common clock source.\n" );	
-    printf( "Configure JP1 and JP2 accordingly.\n" );	
-    printf( "Make sure connector cables for both clock inputs are of same length.\n" );
-}
-#pragma endregion
-#pragma region: Functions to print the next prompt/question on whether to set up the on-board amplifier/s
-void print_prompt2_single() {
-    printf( "\nConnected DAC outputs to on-board amplifiers?\n" );
-    printf( "If yes, press y. If no, press any other key.\n" );
-}
-void print_prompt2_multi() {	
-    printf( "\nConnected DAC outputs to on-board amplifiers?\n" );	
-    printf( "(To ensure synchronization between the two devices, output configuration in both boards should be the same.)\n" );	
-    printf( "If yes, connect a 7V to 12V 30W wall wart to SDP-K1 then press 'y'. If no, press any other key.\n" );	
-}	
-void print_prompt2_ext() {	
-    printf("\nOn-board amplifiers are enabled for both boards.\n");	
-}
-#pragma endregion
-#pragma region: Functions to print the summary of and select playable AD910x waveform configuration examples
-void print_menu_single() {
-    printf("\nExample Summary\n");
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("   1 - 4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");
-        printf("   2 - 4 Pulses Generated from an SRAM Vector\n");
-        printf("   3 - 4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");
-        printf("   4 - Pulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");
-        printf("   5 - Pulsed DDS-Generated Sine Waves Amplitude-Modulated by an SRAM Vector\n");
-        printf("   6 - DDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");
-    } else if( ACTIVE_DEVICE == "AD9102" ) {
-        printf("   1 - Gaussian Pulse\n");
-        printf("   2 - Pulse Generated from an SRAM Vector\n");
-        printf("   3 - Pulsed DDS-Generated Sine Wave\n");
-        printf("   4 - Sawtooth Waveform\n");
-        printf("   5 - Pulsed DDS-Generated Sine Wave Amplitude-Modulated by an SRAM Vector\n");
-        printf("   6 - DDS-Generated Sine Wave\n");
-    }
-    printf("Select an option: \n");
-}
-void print_menu_multi() {	
-    printf("\nExample Summary\n");	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("   1 - 4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");	
-        printf("   2 - 4 Pulses Generated from an SRAM Vector\n");	
-        printf("   3 - 4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");	
-        printf("   4 - Pulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");	
-        printf("   5 - Pulsed DDS-Generated Sine Waves Amplitude-Modulated by an SRAM Vector\n");	
-        printf("   6 - DDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");	
-    } else if( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("   1 - Gaussian Pulse\n");	
-        printf("   2 - Pulse Generated from an SRAM Vector\n");	
-        printf("   3 - Pulsed DDS-Generated Sine Wave\n");	
-        printf("   4 - Sawtooth Waveform\n");	
-        printf("   5 - Pulsed DDS-Generated Sine Wave Amplitude-Modulated by an SRAM Vector\n");	
-        printf("   6 - DDS-Generated Sine Wave\n");	
-    }	
-    printf("Select an option for board 1: \n");	
-}	
-void print_menu_ext() {	
-    printf("\nSelect an option for board 2: \n");	
-}
-void sel_example_single( char example ) {
-    switch ( example ) {
-            case '1':
-                prog_example1_single();
-                break;
-            case '2':
-                prog_example2_single();
-                break;
-            case '3':
-                prog_example3_single();
-                break;
-            case '4':
-                prog_example4_single();
-                break;
-            case '5':    
-                prog_example5_single();
-                break;
-            case '6':
-                prog_example6_single();
-                break;
-            default:
-                printf("\n****Invalid Entry****\n\n");
-                break;
-        }
-    device_single.AD910x_start_pattern();
-}
-void sel_example_multi( bool dev_num, char example ) {	
-    switch ( example ) {	
-        case '1':	
-            prog_example1_multi( dev_num );	
-            break;	
-        case '2':	
-            prog_example2_multi( dev_num );	
-            break;	
-        case '3':	
-            prog_example3_multi( dev_num );	
-            break;	
-        case '4':	
-            prog_example4_multi( dev_num );	
-            break;
-        case '5':    	
-            prog_example5_multi( dev_num );	
-            break;	
-        case '6':	
-            prog_example6_multi( dev_num );	
-            break;	
-        default:	
-            printf( "\n****Invalid Entry****\n\n" );	
-            break;
-    }
-    if ( dev_num ) {
-        device_multi.AD910x_start_pattern();
-    }
-}
-#pragma endregion
-#pragma region: Functions to play Example 1
-void prog_example1_single() {
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("\n4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_sram( example1_RAM_gaussian );
-        device_single.AD910x_update_regs( AD9106_example1_regval );
-    } else if( ACTIVE_DEVICE == "AD9102" ) {
-        printf("\nGaussian Pulse\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_sram( example1_RAM_gaussian );
-        device_single.AD910x_update_regs( AD9102_example1_regval );
-    }
-}
-void prog_example1_multi( bool dev_num ) {	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("\n4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_sram( dev_num, example1_RAM_gaussian );	
-        device_multi.AD910x_update_regs( dev_num, AD9106_example1_regval );	
-    } else if( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("\nGaussian Pulse\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_sram( dev_num, example1_RAM_gaussian );	
-        device_multi.AD910x_update_regs( dev_num, AD9102_example1_regval );	
-    }	
-}
-#pragma endregion
-#pragma region: Functions to play Example 2
-void prog_example2_single() {
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("\n4 Pulses Generated from an SRAM Vector\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_sram( example2_4096_ramp );
-        device_single.AD910x_update_regs( AD9106_example2_regval );
-    } else if( ACTIVE_DEVICE == "AD9102" ) {
-        printf("\nPulse Generated from an SRAM Vector\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_sram( example2_4096_ramp );
-        device_single.AD910x_update_regs( AD9102_example2_regval );
-    }
-}
-void prog_example2_multi( bool dev_num ) {	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("\n4 Pulses Generated from an SRAM Vector\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_sram( dev_num, example2_4096_ramp );	
-        device_multi.AD910x_update_regs( dev_num, AD9106_example2_regval );	
-    } else if( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("\nPulse Generated from an SRAM Vector\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_sram( dev_num, example2_4096_ramp );	
-        device_multi.AD910x_update_regs( dev_num, AD9102_example2_regval );	
-    }	
-}
-#pragma endregion
-#pragma region: Functions to play Example 3
-void prog_example3_single() {
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("\n4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_regs( AD9106_example3_regval );
-    } else if( ACTIVE_DEVICE == "AD9102" ) {
-        printf("\nPulsed DDS-Generated Sine Wave\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_regs( AD9102_example3_regval );
-    }       
-}
-void prog_example3_multi( bool dev_num ) {	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("\n4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_regs( dev_num, AD9106_example3_regval );	
-    } else if( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("\nPulsed DDS-Generated Sine Wave\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_regs( dev_num, AD9102_example3_regval );	
-    }     	
-}
-#pragma endregion
-#pragma region: Functions to play Example 4
-void prog_example4_single() {
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("\nPulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_regs( AD9106_example4_regval );
-    } else if( ACTIVE_DEVICE == "AD9102" ) {
-        printf("\nSawtooth Waveform\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_regs( AD9102_example4_regval );
-    }       
-}
-void prog_example4_multi( bool dev_num ) {	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("\nPulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_regs( dev_num, AD9106_example4_regval );	
-    } else if( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("\nSawtooth Waveform\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_regs( dev_num, AD9102_example4_regval );	
-    }     	
-}
-#pragma endregion
-#pragma region: Functions to play Example 5
-void prog_example5_single() {
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("\n4 Pulses Generated from an SRAM Vector\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_sram( example5_RAM_gaussian );
-        device_single.AD910x_update_regs( AD9106_example5_regval );
-    } else if ( ACTIVE_DEVICE == "AD9102" ) {
-        printf("\nPulse Generated from an SRAM Vector\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_sram( example5_RAM_gaussian );
-        device_single.AD910x_update_regs( AD9102_example5_regval );
-    }  
-}
-void prog_example5_multi( bool dev_num ) {	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("\n4 Pulses Generated from an SRAM Vector\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_sram( dev_num, example5_RAM_gaussian );	
-        device_multi.AD910x_update_regs( dev_num, AD9106_example5_regval );	
-    } else if ( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("\nPulse Generated from an SRAM Vector\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_sram( dev_num, example5_RAM_gaussian );	
-        device_multi.AD910x_update_regs( dev_num, AD9102_example5_regval );	
-    }	
-}
-#pragma endregion
-#pragma region: Functions to play Example 6
-void prog_example6_single() {
-    if ( ACTIVE_DEVICE == "AD9106" ) {
-        printf("\nDDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_regs( AD9106_example6_regval );
-    } else if( ACTIVE_DEVICE == "AD9102" ) {
-        printf("\nDDS-Generated Sine Wave\n");
-        thread_sleep_for(500);
-        device_single.AD910x_update_regs( AD9102_example6_regval );
-    }      
-}
-void prog_example6_multi( bool dev_num ) {	
-    if ( ACTIVE_DEVICE == "AD9106" ) {	
-        printf("\nDDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_regs( dev_num, AD9106_example6_regval );	
-    } else if( ACTIVE_DEVICE == "AD9102" ) {	
-        printf("\nDDS-Generated Sine Wave\n");	
-        thread_sleep_for(500);	
-        device_multi.AD910x_update_regs( dev_num, AD9102_example6_regval );	
-    }   	
-}
-#pragma endregion
-#pragma region: Function to print prompt/question on whether to choose another pattern
-void print_prompt3() {
-    printf( "\nChoose another pattern?\n" );
-    printf( "y       -  Select new pattern.\n" );
-    printf( "Any key -  Exit program.\n" );
-}
-#pragma endregion
-#pragma region: Function to stop pattern generation
-void stop_example_single() {
-    device_single.AD910x_stop_pattern();
-    printf( "\nPattern stopped.\n" );
-}
-void stop_example_multi() {
-    device_multi.AD910x_stop_pattern();
-    printf( "\nPattern stopped.\n" );
-}
-#pragma endregion
-#pragma region: Function to print prompt/question on whether to exit the program
-void print_prompt4() {
-    printf("\nExiting program...\n");
-}
-#pragma endregion
-#pragma endregion
+/*******************************************************************************
+    @file:   main.cpp
+    
+    @brief:  Main module for EVAL-AD910x application interface
+--------------------------------------------------------------------------------
+    Copyright (c) 2024 Analog Devices, Inc. All Rights Reserved.
+    This software is proprietary to Analog Devices, Inc. and its licensors.
+
+    Licensed under the Apache License, Version 2.0 (the "License");
+    you may not use this file except in compliance with the License.
+
+    Unless required by applicable law or agreed to in writing, software
+    distributed under the License is distributed on an "AS IS" BASIS,
+    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+    See the License for the specific language governing permissions and
+    limitations under the License. 
+*******************************************************************************/
+
+/*******************************************************************************
+    About AD910x
+        * Product Page: https://www.analog.com/AD9102, https://www.analog.com/AD9106
+        * Eval Page:    https://www.analog.com/eval-ad9102, https://www.analog.com/eval-ad9106
+        * Wiki Guide:   https://wiki.analog.com/resources/eval/dpg/eval-ad9106-mbed
+
+    User Instructions
+        * To use the code for single-board evaluation: Uncomment main_single() in main()
+        * To use the code for multi-board evaluation: Uncomment main_multi() in main()
+        * To control a single board from a host program: Uncomment main_host() in main()
+          (binary command protocol, see ad910x_cmd.h and host/ad910x_host.h)
+*******************************************************************************/
+
+// *** Libraries *** //
+#include "mbed.h"
+#include "platform/mbed_thread.h"
+#include "config.h"
+#include "ad910x.h"
+#include "ad910x_spi.h"
+#include "ad910x_log.h"
+#include "ad910x_cmdserver.h"
+#include "ad910x_worker.h"
+#include "ad910x_preset.h"
+
+// *** Defines for UART Protocol *** //
+#define BAUD_RATE       115200
+#define DUMP_BAUD       921600                      // Baud rate of binary dumps (see ad910x_dump.h)
+#define HOST_BAUD       921600                      // Baud rate of the host command protocol (see ad910x_cmd.h)
+#define UART_RX_RING    512                         // Receive ring of the UART, holds the host stream window while SPI runs
+
+// *** Flags of log_flags *** //
+#define LOG_DATA        0x1                         // reg_log received a record while drain_log slept
+#define LOG_IDLE        0x2                         // drain_log printed every record and sleeps
+
+AD910x_SPI spi_single( PA_15 );                     // SPI bus and pins for single-board use case (see ad910x_spi.h)
+AD910x_SPI spi_multi( PA_15, PB_15 );               // SPI bus and pins for multi-board use case (see ad910x_spi.h)
+AD910x_SINGLE device_single( spi_single );          // Board variable definition for single-board use case (see ad910x.h)          
+AD910x_MULTI device_multi( spi_multi );             // Board variable definition for multi-board use case (see ad910x.h)
+AD910x_PresetLib presets_single( device_single, 0x1 );  // Examples of the single-board use case, switched by delta (see ad910x_preset.h)
+
+DigitalOut en_cvddx( PG_7, 0 );                     // DigitalOut instance for enable pin of on-board oscillator supply
+DigitalOut shdn_n_lt3472( PG_9, 0 );                // DigitalOut instance for shutdown/enable pin of on-board amplifier supply
+
+// * Configure and instantiate UART protocol and baud rate * //
+UnbufferedSerial pc( USBTX, USBRX, BAUD_RATE );
+
+uint8_t uart_rx[UART_RX_RING];                      // Bytes received from the UART, filled by uart_rx_irq
+volatile uint32_t uart_rx_head = 0;                 // Written by uart_rx_irq only
+volatile uint32_t uart_rx_tail = 0;                 // Written by the main thread only
+Semaphore uart_rx_ready( 0 );                       // Released by uart_rx_irq; the main thread sleeps on it while uart_rx is empty
+
+AD910x_LogQueue reg_log;                            // Register/SRAM display records of both drivers (see ad910x_log.h)
+Thread log_thread( osPriorityLow );                 // Prints reg_log, so UART output does not stall SPI configuration
+EventFlags log_flags;                               // LOG_DATA/LOG_IDLE handshake between commands and log_thread
+
+#pragma region: Function Declarations
+/*** Single-Board ***/
+void main_single( void );
+void setup_device_single( void );
+void load_presets_single( void );
+void print_menu_single( void );
+void print_prompt1_single( void );
+void print_prompt2_single( void );
+void print_title_single( void );
+void sel_example_single( char example );
+void prog_example1_single( void );
+void prog_example2_single( void );
+void prog_example3_single( void );
+void prog_example4_single( void );
+void prog_example5_single( void );
+void prog_example6_single( void );
+void select_preset_single( uint8_t slot );
+void stop_example_single( void );
+
+/*** Multi-Board ***/
+void main_multi( void );
+void setup_device_multi( void );
+void print_menu_multi( void );
+void print_menu_ext( void );
+void print_prompt1_multi( void );
+void print_prompt2_multi( void );
+void print_prompt2_ext( void );
+void print_title_multi( void );	
+void sel_example_multi( bool dev_num, char example );	
+void prog_example1_multi( bool dev_num );	
+void prog_example2_multi( bool dev_num );	
+void prog_example3_multi( bool dev_num );	
+void prog_example4_multi( bool dev_num );	
+void prog_example5_multi( bool dev_num );	
+void prog_example6_multi( bool dev_num );
+void stop_example_multi( void );
+
+/*** Host-Controlled ***/
+void main_host( void );
+
+/*** Common Functions ***/
+void uart_rx_irq( void );
+char wait_key( void );
+void drain_log( void );
+void wake_log( void *ctx );
+void flush_log( void );
+int uart_write( void *ctx, const uint8_t data[], uint32_t n );
+void dump_single( void );
+void dump_multi( bool dev_num );
+void print_prompt3( void );
+void print_prompt4( void );
+#pragma endregion
+
+// *** Main Functions *** //
+int main() {
+    reg_log.on_push( wake_log, NULL );
+    log_thread.start( drain_log );
+    pc.attach( uart_rx_irq, UnbufferedSerial::RxIrq );
+    //main_single();
+    //main_multi();
+    //main_host();
+    return 0;
+}
+
+#pragma region (Function Definitions)
+#pragma region: Main Functions
+void main_single(){
+    char ext_clk = 'y';
+    char amp_out = 'n';
+    char stop = 'n';
+    char exit = 'n';
+    char example = 1;
+    uint8_t connected = 1;
+    
+    spi_single.resetb = 1;
+    spi_single.triggerb = 1;
+    
+    setup_device_single();
+    print_title_single();
+    
+    // * Configure Board Settings * //
+    print_prompt1_single();
+    ext_clk = wait_key();
+    if ( ext_clk == 'y' ) {
+        en_cvddx = 0;
+        printf("\nPlease connect external clock source to J10.\n");
+    } else {
+        en_cvddx = 1;
+        printf("\nOn-board oscillator supply is enabled.\n");
+    }
+    print_prompt2_single();
+    amp_out = wait_key();
+    if ( amp_out == 'y' ) {
+        shdn_n_lt3472 = 1;
+        printf("\nOn-board amplifier supply is enabled.\n");
+    } else {
+        shdn_n_lt3472 = 0;
+    }
+    
+    // * selecting Waveform Pattern * //
+    while( connected == 1 ) {
+        print_menu_single();
+        example = wait_key();
+        sel_example_single( example );
+        flush_log();
+        
+        print_prompt3();
+        stop = wait_key();
+        while ( stop == 'd' ) {
+            dump_single();
+            print_prompt3();
+            stop = wait_key();
+        }
+        if ( stop == 'y' ) {	
+            stop_example_single();	
+            stop = 'n';	
+        } else {	
+            stop_example_single();
+            connected = 0;	
+            print_prompt4();		
+        }	
+    }
+}
+void main_multi(){
+    char amp_out = 'n';	
+    char stop = 'n';	
+    char exit = 'n';	
+    char example_b1 = 3;	
+    char example_b2 = 3;	
+    uint8_t connected = 1;
+    bool device2;
+    	
+    spi_multi.resetb = 1;	
+    spi_multi.triggerb = 1;
+    
+    setup_device_multi();	
+    print_title_multi();	
+
+    // * Configure Board Settings * //
+    print_prompt1_multi();		
+    print_prompt2_multi();	
+    amp_out = wait_key();		
+    if ( amp_out == 'y' ) {	
+        shdn_n_lt3472 = 1;	
+        print_prompt2_ext();	
+    } else {	
+        shdn_n_lt3472 = 0;	
+    }
+    // * selecting Waveform Pattern * //
+    while( connected == 1 ) {
+        device2 = false;                            // Board 1 selection
+        print_menu_multi();	
+        example_b1 = wait_key();
+        sel_example_multi( device2, example_b1 );
+        flush_log();
+        
+        device2 = true;                             // Board 2 selection
+        print_menu_ext();
+        example_b2 = wait_key();	
+        sel_example_multi( device2, example_b2 );
+        flush_log();
+        print_prompt3();	
+        stop = wait_key();
+        while ( stop == 'd' ) {
+            printf( "\nDump board 1 or 2?\n" );
+            dump_multi( wait_key() == '2' );
+            print_prompt3();
+            stop = wait_key();
+        }
+        if ( stop == 'y' ) {	
+            stop_example_multi();	
+            stop = 'n';	
+        } else {	
+            stop_example_multi();
+            connected = 0;	
+            print_prompt4();		
+        }	
+    }
+}
+void main_host() {
+    // * The bus thread owns the driver from here on; commands, and any sweep or
+    //   UI producer added later, reach it as worker jobs * //
+    static AD910x_Worker bus_single( device_single );
+    static AD910x_CmdServer server( device_single, uart_write, &pc, &bus_single );
+    
+    spi_single.resetb = 1;
+    spi_single.triggerb = 1;
+    
+    setup_device_single();
+    device_single.log_level = AD910X_LOG_OFF;
+    bus_single.start();
+    printf( "\nHost command mode at %d baud\n", HOST_BAUD );
+    thread_sleep_for(10);
+    pc.baud( HOST_BAUD );
+    
+    // * Serve commands while the interrupt receives the next stream chunk; the thread
+    //   sleeps while nothing arrives, and a gap in the input drops a partial frame
+    //   so the host retry is parsed * //
+    while ( true ) {
+        if ( uart_rx_tail != uart_rx_head ) {
+            server.feed( uart_rx[uart_rx_tail % UART_RX_RING] );
+            uart_rx_tail = uart_rx_tail + 1;
+        } else if ( !uart_rx_ready.try_acquire_for( AD910X_CMD_IDLE_MS * 1ms ) ) {
+            server.idle();
+        }
+    }
+}
+#pragma endregion
+#pragma region: Functions to set up SPI communication
+void setup_device_single() {
+    device_single.log_level = AD910X_LOG_DEFERRED;
+    device_single.log_queue = &reg_log;
+    device_single.spi_init( WORD_LEN, POL, FREQ );
+    device_single.AD910x_reg_reset();
+    device_single.AD910x_train_spi( TRAIN_FREQ );
+    load_presets_single();
+}
+void load_presets_single() {
+    bool ad9106 = ( ACTIVE_DEVICE == "AD9106" );
+    presets_single.add( { "example1", ad9106 ? AD9106_example1_regval : AD9102_example1_regval, example1_RAM_gaussian, NULL, AD910X_TRIG_START } );
+    presets_single.add( { "example2", ad9106 ? AD9106_example2_regval : AD9102_example2_regval, example2_4096_ramp, NULL, AD910X_TRIG_START } );
+    presets_single.add( { "example3", ad9106 ? AD9106_example3_regval : AD9102_example3_regval, NULL, NULL, AD910X_TRIG_START } );
+    presets_single.add( { "example4", ad9106 ? AD9106_example4_regval : AD9102_example4_regval, NULL, NULL, AD910X_TRIG_START } );
+    presets_single.add( { "example5", ad9106 ? AD9106_example5_regval : AD9102_example5_regval, example5_RAM_gaussian, NULL, AD910X_TRIG_START } );
+    presets_single.add( { "example6", ad9106 ? AD9106_example6_regval : AD9102_example6_regval, NULL, NULL, AD910X_TRIG_START } );
+}
+void setup_device_multi() {
+    device_multi.log_level = AD910X_LOG_DEFERRED;
+    device_multi.log_queue = &reg_log;
+    device_multi.spi_init( WORD_LEN, POL, FREQ );
+    device_multi.AD910x_reg_reset();
+    device_multi.AD910x_train_spi( TRAIN_FREQ );
+}
+#pragma endregion
+#pragma region: Functions to print the title block when program first starts
+void print_title_single() {
+    printf("\n***********************************************************************\n");
+    printf("* EVAL-%s Demonstration Program                                   *\n", ACTIVE_DEVICE);
+    printf("*                                                                     *\n");
+    printf("* This program demonstrates how to generate waveforms with the %s *\n", ACTIVE_DEVICE);
+    printf("* using example register configurations in the datasheet.             *\n");
+    printf("* This program is developed on Mbed OS version 6.                     *\n");
+    printf("***********************************************************************\n");   
+}
+void print_title_multi() {	
+    printf("\n***********************************************************************\n");	
+    printf("* EVAL-%s Demonstration Program                                   *\n", ACTIVE_DEVICE);	
+    printf("*                                                                     *\n");	
+    printf("* This program demonstrates multi-chip synchronization using two %ss *\n", ACTIVE_DEVICE);	
+    printf("* using example register configurations in the datasheet.             *\n");	
+    printf("* This program is developed on Mbed OS version 6.                     *\n");	
+    printf("***********************************************************************\n");   	
+}
+#pragma endregion
+#pragma region: Functions to print the first prompt/question on whether to set up the on-board oscillator/s
+void print_prompt1_single() {
+    printf( "\nUsing external clock source?\n" );
+    printf( "If yes, press y. If no, press any other key.\n" );
+}
+void print_prompt1_multi() {
+    printf( "\nPlease connect clock inputs of both evaluation boards to a common clock source.\n" );	
+    printf( "Configure JP1 and JP2 accordingly.\n" );	
+    printf( "Make sure connector cables for both clock inputs are of same length.\n" );
+}
+#pragma endregion
+#pragma region: Functions to print the next prompt/question on whether to set up the on-board amplifier/s
+void print_prompt2_single() {
+    printf( "\nConnected DAC outputs to on-board amplifiers?\n" );
+    printf( "If yes, press y. If no, press any other key.\n" );
+}
+void print_prompt2_multi() {	
+    printf( "\nConnected DAC outputs to on-board amplifiers?\n" );	
+    printf( "(To ensure synchronization between the two devices, output configuration in both boards should be the same.)\n" );	
+    printf( "If yes, connect a 7V to 12V 30W wall wart to SDP-K1 then press 'y'. If no, press any other key.\n" );	
+}	
+void print_prompt2_ext() {	
+    printf("\nOn-board amplifiers are enabled for both boards.\n");	
+}
+#pragma endregion
+#pragma region: Functions to print the summary of and select playable AD910x waveform configuration examples
+void print_menu_single() {
+    printf("\nExample Summary\n");
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("   1 - 4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");
+        printf("   2 - 4 Pulses Generated from an SRAM Vector\n");
+        printf("   3 - 4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");
+        printf("   4 - Pulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");
+        printf("   5 - Pulsed DDS-Generated Sine Waves Amplitude-Modulated by an SRAM Vector\n");
+        printf("   6 - DDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");
+    } else if( ACTIVE_DEVICE == "AD9102" ) {
+        printf("   1 - Gaussian Pulse\n");
+        printf("   2 - Pulse Generated from an SRAM Vector\n");
+        printf("   3 - Pulsed DDS-Generated Sine Wave\n");
+        printf("   4 - Sawtooth Waveform\n");
+        printf("   5 - Pulsed DDS-Generated Sine Wave Amplitude-Modulated by an SRAM Vector\n");
+        printf("   6 - DDS-Generated Sine Wave\n");
+    }
+    printf("Select an option: \n");
+}
+void print_menu_multi() {	
+    printf("\nExample Summary\n");	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("   1 - 4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");	
+        printf("   2 - 4 Pulses Generated from an SRAM Vector\n");	
+        printf("   3 - 4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");	
+        printf("   4 - Pulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");	
+        printf("   5 - Pulsed DDS-Generated Sine Waves Amplitude-Modulated by an SRAM Vector\n");	
+        printf("   6 - DDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");	
+    } else if( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("   1 - Gaussian Pulse\n");	
+        printf("   2 - Pulse Generated from an SRAM Vector\n");	
+        printf("   3 - Pulsed DDS-Generated Sine Wave\n");	
+        printf("   4 - Sawtooth Waveform\n");	
+        printf("   5 - Pulsed DDS-Generated Sine Wave Amplitude-Modulated by an SRAM Vector\n");	
+        printf("   6 - DDS-Generated Sine Wave\n");	
+    }	
+    printf("Select an option for board 1: \n");	
+}	
+void print_menu_ext() {	
+    printf("\nSelect an option for board 2: \n");	
+}
+void sel_example_single( char example ) {
+    switch ( example ) {
+            case '1':
+                prog_example1_single();
+                break;
+            case '2':
+                prog_example2_single();
+                break;
+            case '3':
+                prog_example3_single();
+                break;
+            case '4':
+                prog_example4_single();
+                break;
+            case '5':    
+                prog_example5_single();
+                break;
+            case '6':
+                prog_example6_single();
+                break;
+            default:
+                printf("\n****Invalid Entry****\n\n");
+                break;
+        }
+}
+void sel_example_multi( bool dev_num, char example ) {	
+    switch ( example ) {	
+        case '1':	
+            prog_example1_multi( dev_num );	
+            break;	
+        case '2':	
+            prog_example2_multi( dev_num );	
+            break;	
+        case '3':	
+            prog_example3_multi( dev_num );	
+            break;	
+        case '4':	
+            prog_example4_multi( dev_num );	
+            break;
+        case '5':    	
+            prog_example5_multi( dev_num );	
+            break;	
+        case '6':	
+            prog_example6_multi( dev_num );	
+            break;	
+        default:	
+            printf( "\n****Invalid Entry****\n\n" );	
+            break;
+    }
+    if ( dev_num ) {
+        device_multi.AD910x_start_pattern();
+    }
+}
+#pragma endregion
+#pragma region: Functions to play Example 1
+void prog_example1_single() {
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("\n4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");
+    } else if( ACTIVE_DEVICE == "AD9102" ) {
+        printf("\nGaussian Pulse\n");
+    }
+    select_preset_single( 0 );
+}
+void prog_example1_multi( bool dev_num ) {	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("\n4 Gaussian Pulses with Different Start Delays and Digital Gain Settings\n");	
+        device_multi.AD910x_update_sram( dev_num, example1_RAM_gaussian );	
+        device_multi.AD910x_update_regs( dev_num, AD9106_example1_regval );	
+    } else if( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("\nGaussian Pulse\n");	
+        device_multi.AD910x_update_sram( dev_num, example1_RAM_gaussian );	
+        device_multi.AD910x_update_regs( dev_num, AD9102_example1_regval );	
+    }	
+}
+#pragma endregion
+#pragma region: Functions to play Example 2
+void prog_example2_single() {
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("\n4 Pulses Generated from an SRAM Vector\n");
+    } else if( ACTIVE_DEVICE == "AD9102" ) {
+        printf("\nPulse Generated from an SRAM Vector\n");
+    }
+    select_preset_single( 1 );
+}
+void prog_example2_multi( bool dev_num ) {	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("\n4 Pulses Generated from an SRAM Vector\n");	
+        device_multi.AD910x_update_sram( dev_num, example2_4096_ramp );	
+        device_multi.AD910x_update_regs( dev_num, AD9106_example2_regval );	
+    } else if( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("\nPulse Generated from an SRAM Vector\n");	
+        device_multi.AD910x_update_sram( dev_num, example2_4096_ramp );	
+        device_multi.AD910x_update_regs( dev_num, AD9102_example2_regval );	
+    }	
+}
+#pragma endregion
+#pragma region: Functions to play Example 3
+void prog_example3_single() {
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("\n4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");
+    } else if( ACTIVE_DEVICE == "AD9102" ) {
+        printf("\nPulsed DDS-Generated Sine Wave\n");
+    }
+    select_preset_single( 2 );
+}
+void prog_example3_multi( bool dev_num ) {	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("\n4 Pulsed DDS-Generated Sine Waves with Different Start Delays and Digital Gain Settings\n");	
+        device_multi.AD910x_update_regs( dev_num, AD9106_example3_regval );	
+    } else if( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("\nPulsed DDS-Generated Sine Wave\n");	
+        device_multi.AD910x_update_regs( dev_num, AD9102_example3_regval );	
+    }     	
+}
+#pragma endregion
+#pragma region: Functions to play Example 4
+void prog_example4_single() {
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("\nPulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");
+    } else if( ACTIVE_DEVICE == "AD9102" ) {
+        printf("\nSawtooth Waveform\n");
+    }
+    select_preset_single( 3 );
+}
+void prog_example4_multi( bool dev_num ) {	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("\nPulsed DDS-Generated Sine Wave and 3 Sawtooth Generator Waveforms\n");	
+        device_multi.AD910x_update_regs( dev_num, AD9106_example4_regval );	
+    } else if( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("\nSawtooth Waveform\n");	
+        device_multi.AD910x_update_regs( dev_num, AD9102_example4_regval );	
+    }     	
+}
+#pragma endregion
+#pragma region: Functions to play Example 5
+void prog_example5_single() {
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("\n4 Pulses Generated from an SRAM Vector\n");
+    } else if ( ACTIVE_DEVICE == "AD9102" ) {
+        printf("\nPulse Generated from an SRAM Vector\n");
+    }
+    select_preset_single( 4 );
+}
+void prog_example5_multi( bool dev_num ) {	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("\n4 Pulses Generated from an SRAM Vector\n");	
+        device_multi.AD910x_update_sram( dev_num, example5_RAM_gaussian );	
+        device_multi.AD910x_update_regs( dev_num, AD9106_example5_regval );	
+    } else if ( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("\nPulse Generated from an SRAM Vector\n");	
+        device_multi.AD910x_update_sram( dev_num, example5_RAM_gaussian );	
+        device_multi.AD910x_update_regs( dev_num, AD9102_example5_regval );	
+    }	
+}
+#pragma endregion
+#pragma region: Functions to play Example 6
+void prog_example6_single() {
+    if ( ACTIVE_DEVICE == "AD9106" ) {
+        printf("\nDDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");
+    } else if( ACTIVE_DEVICE == "AD9102" ) {
+        printf("\nDDS-Generated Sine Wave\n");
+    }
+    select_preset_single( 5 );
+}
+void prog_example6_multi( bool dev_num ) {	
+    if ( ACTIVE_DEVICE == "AD9106" ) {	
+        printf("\nDDS-Generated Sine Wave and 3 Sawtooth Waveforms\n");	
+        device_multi.AD910x_update_regs( dev_num, AD9106_example6_regval );	
+    } else if( ACTIVE_DEVICE == "AD9102" ) {	
+        printf("\nDDS-Generated Sine Wave\n");	
+        device_multi.AD910x_update_regs( dev_num, AD9102_example6_regval );	
+    }   	
+}
+#pragma endregion
+#pragma region: Function to switch the single board to a preset (see ad910x_preset.h)
+void select_preset_single( uint8_t slot ) {
+    uint8_t from = presets_single.active();
+    if ( presets_single.select( slot ) < 0 ) {
+        printf( "\n****Preset not loaded****\n" );
+        return;
+    }
+    const AD910x_Transition &t = presets_single.transition( from, slot );
+    printf( "Switched in %u us: %u registers, %u SRAM words written\n", (unsigned)t.us, t.regs, t.sram );
+}
+#pragma endregion
+#pragma region: Functions to print deferred register/SRAM output
+void drain_log() {
+    AD910x_LogRecord rec;
+    uint32_t dropped;
+    
+    // * Sleep until reg_log.push() wakes the thread; LOG_IDLE is set only after the last printf returned * //
+    while ( true ) {
+        while ( reg_log.pop( rec ) ) {
+            printf( "0x%04X, 0x%04X\n", rec.addr, rec.data );
+        }
+        dropped = reg_log.take_dropped();
+        if ( dropped != 0 ) {
+            printf( "(%u records dropped)\n", (unsigned)dropped );
+        }
+        if ( reg_log.idle() ) {
+            log_flags.set( LOG_IDLE );
+            log_flags.wait_any( LOG_DATA );
+        }
+    }
+}
+void wake_log( void * ) {
+    log_flags.set( LOG_DATA );
+}
+void flush_log() {
+    // * A stale LOG_IDLE only costs one more check of reg_log * //
+    while ( !reg_log.drained() ) {
+        log_flags.wait_any( LOG_IDLE );
+    }
+}
+#pragma endregion
+#pragma region: Functions to receive keys and host commands from the UART
+void uart_rx_irq() {
+    uint8_t byte;
+    while ( pc.readable() && pc.read( &byte, 1 ) == 1 ) {
+        if ( uart_rx_head - uart_rx_tail < UART_RX_RING ) {
+            uart_rx[uart_rx_head % UART_RX_RING] = byte;
+            uart_rx_head = uart_rx_head + 1;
+        }
+    }
+    uart_rx_ready.release();
+}
+char wait_key() {
+    char key;
+    
+    // * Sleep until a key arrives; line endings sent by terminals are not keys * //
+    do {
+        while ( uart_rx_tail == uart_rx_head ) {
+            uart_rx_ready.acquire();
+        }
+        key = uart_rx[uart_rx_tail % UART_RX_RING];
+        uart_rx_tail = uart_rx_tail + 1;
+    } while ( key == '\r' || key == '\n' );
+    return key;
+}
+#pragma endregion
+#pragma region: Functions to dump registers and SRAM in binary (decode with host/ad910x_dumpdecode)
+int uart_write( void *ctx, const uint8_t data[], uint32_t n ) {
+    return ( ( (UnbufferedSerial *)ctx )->write( data, n ) == (ssize_t)n ) ? 0 : -1;
+}
+void dump_single() {
+    flush_log();
+    printf( "\nBinary dump at %d baud...\n", DUMP_BAUD );
+    thread_sleep_for(10);
+    pc.baud( DUMP_BAUD );
+    device_single.AD910x_dump( AD910X_SRAM_SIZE, uart_write, &pc );
+    thread_sleep_for(10);
+    pc.baud( BAUD_RATE );
+}
+void dump_multi( bool dev_num ) {
+    flush_log();
+    printf( "\nBinary dump of board %d at %d baud...\n", dev_num + 1, DUMP_BAUD );
+    thread_sleep_for(10);
+    pc.baud( DUMP_BAUD );
+    device_multi.AD910x_dump( dev_num, AD910X_SRAM_SIZE, uart_write, &pc );
+    thread_sleep_for(10);
+    pc.baud( BAUD_RATE );
+}
+#pragma endregion
+#pragma region: Function to print prompt/question on whether to choose another pattern
+void print_prompt3() {
+    printf( "\nChoose another pattern?\n" );
+    printf( "y       -  Select new pattern.\n" );
+    printf( "d       -  Dump registers and SRAM in binary (decode with host/ad910x_dumpdecode).\n" );
+    printf( "Any key -  Exit program.\n" );
+}
+#pragma endregion
+#pragma region: Function to stop pattern generation
+void stop_example_single() {
+    device_single.AD910x_stop_pattern();
+    printf( "\nPattern stopped.\n" );
+}
+void stop_example_multi() {
+    device_multi.AD910x_stop_pattern();
+    printf( "\nPattern stopped.\n" );
+}
+#pragma endregion
+#pragma region: Function to print prompt/question on whether to exit the program
+void print_prompt4() {
+    printf("\nExiting program...\n");
+}
+#pragma endregion
+#pragma endregion